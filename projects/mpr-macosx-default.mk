@@ -175,6 +175,7 @@ clean:
 	rm -f "$(CONFIG)/obj/encode.o"
 	rm -f "$(CONFIG)/obj/epoll.o"
 	rm -f "$(CONFIG)/obj/event.o"
+	rm -f "$(CONFIG)/obj/fiber.o"
 	rm -f "$(CONFIG)/obj/file.o"
 	rm -f "$(CONFIG)/obj/fs.o"
 	rm -f "$(CONFIG)/obj/hash.o"
@@ -199,6 +200,7 @@ clean:
 	rm -f "$(CONFIG)/obj/test.o"
 	rm -f "$(CONFIG)/obj/thread.o"
 	rm -f "$(CONFIG)/obj/time.o"
+	rm -f "$(CONFIG)/obj/uring.o"
 	rm -f "$(CONFIG)/obj/vxworks.o"
 	rm -f "$(CONFIG)/obj/wait.o"
 	rm -f "$(CONFIG)/obj/wide.o"
@@ -427,402 +429,360 @@ $(CONFIG)/obj/event.o: \
 	$(CC) -c -o $(CONFIG)/obj/event.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/event.c
 
 #
-#   file.o
+#   fiber.o
 #
 DEPS_21 += $(CONFIG)/inc/bit.h
 DEPS_21 += $(CONFIG)/inc/mpr.h
 
+$(CONFIG)/obj/fiber.o: \
+    src/fiber.c $(DEPS_21)
+	@echo '   [Compile] $(CONFIG)/obj/fiber.o'
+	$(CC) -c -o $(CONFIG)/obj/fiber.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/fiber.c
+
+#
+#   file.o
+#
+DEPS_22 += $(CONFIG)/inc/bit.h
+DEPS_22 += $(CONFIG)/inc/mpr.h
+
 $(CONFIG)/obj/file.o: \
-    src/file.c $(DEPS_21)
+    src/file.c $(DEPS_22)
 	@echo '   [Compile] $(CONFIG)/obj/file.o'
 	$(CC) -c -o $(CONFIG)/obj/file.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/file.c
 
 #
 #   fs.o
 #
-DEPS_22 += $(CONFIG)/inc/bit.h
-DEPS_22 += $(CONFIG)/inc/mpr.h
+DEPS_23 += $(CONFIG)/inc/bit.h
+DEPS_23 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/fs.o: \
-    src/fs.c $(DEPS_22)
+    src/fs.c $(DEPS_23)
 	@echo '   [Compile] $(CONFIG)/obj/fs.o'
 	$(CC) -c -o $(CONFIG)/obj/fs.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/fs.c
 
 #
 #   hash.o
 #
-DEPS_23 += $(CONFIG)/inc/bit.h
-DEPS_23 += $(CONFIG)/inc/mpr.h
+DEPS_24 += $(CONFIG)/inc/bit.h
+DEPS_24 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/hash.o: \
-    src/hash.c $(DEPS_23)
+    src/hash.c $(DEPS_24)
 	@echo '   [Compile] $(CONFIG)/obj/hash.o'
 	$(CC) -c -o $(CONFIG)/obj/hash.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/hash.c
 
 #
 #   json.o
 #
-DEPS_24 += $(CONFIG)/inc/bit.h
-DEPS_24 += $(CONFIG)/inc/mpr.h
+DEPS_25 += $(CONFIG)/inc/bit.h
+DEPS_25 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/json.o: \
-    src/json.c $(DEPS_24)
+    src/json.c $(DEPS_25)
 	@echo '   [Compile] $(CONFIG)/obj/json.o'
 	$(CC) -c -o $(CONFIG)/obj/json.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/json.c
 
 #
 #   kqueue.o
 #
-DEPS_25 += $(CONFIG)/inc/bit.h
-DEPS_25 += $(CONFIG)/inc/mpr.h
+DEPS_26 += $(CONFIG)/inc/bit.h
+DEPS_26 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/kqueue.o: \
-    src/kqueue.c $(DEPS_25)
+    src/kqueue.c $(DEPS_26)
 	@echo '   [Compile] $(CONFIG)/obj/kqueue.o'
 	$(CC) -c -o $(CONFIG)/obj/kqueue.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/kqueue.c
 
 #
 #   list.o
 #
-DEPS_26 += $(CONFIG)/inc/bit.h
-DEPS_26 += $(CONFIG)/inc/mpr.h
+DEPS_27 += $(CONFIG)/inc/bit.h
+DEPS_27 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/list.o: \
-    src/list.c $(DEPS_26)
+    src/list.c $(DEPS_27)
 	@echo '   [Compile] $(CONFIG)/obj/list.o'
 	$(CC) -c -o $(CONFIG)/obj/list.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/list.c
 
 #
 #   lock.o
 #
-DEPS_27 += $(CONFIG)/inc/bit.h
-DEPS_27 += $(CONFIG)/inc/mpr.h
+DEPS_28 += $(CONFIG)/inc/bit.h
+DEPS_28 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/lock.o: \
-    src/lock.c $(DEPS_27)
+    src/lock.c $(DEPS_28)
 	@echo '   [Compile] $(CONFIG)/obj/lock.o'
 	$(CC) -c -o $(CONFIG)/obj/lock.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/lock.c
 
 #
 #   log.o
 #
-DEPS_28 += $(CONFIG)/inc/bit.h
-DEPS_28 += $(CONFIG)/inc/mpr.h
+DEPS_29 += $(CONFIG)/inc/bit.h
+DEPS_29 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/log.o: \
-    src/log.c $(DEPS_28)
+    src/log.c $(DEPS_29)
 	@echo '   [Compile] $(CONFIG)/obj/log.o'
 	$(CC) -c -o $(CONFIG)/obj/log.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/log.c
 
 #
 #   mem.o
 #
-DEPS_29 += $(CONFIG)/inc/bit.h
-DEPS_29 += $(CONFIG)/inc/mpr.h
+DEPS_30 += $(CONFIG)/inc/bit.h
+DEPS_30 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/mem.o: \
-    src/mem.c $(DEPS_29)
+    src/mem.c $(DEPS_30)
 	@echo '   [Compile] $(CONFIG)/obj/mem.o'
 	$(CC) -c -o $(CONFIG)/obj/mem.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/mem.c
 
 #
 #   mime.o
 #
-DEPS_30 += $(CONFIG)/inc/bit.h
-DEPS_30 += $(CONFIG)/inc/mpr.h
+DEPS_31 += $(CONFIG)/inc/bit.h
+DEPS_31 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/mime.o: \
-    src/mime.c $(DEPS_30)
+    src/mime.c $(DEPS_31)
 	@echo '   [Compile] $(CONFIG)/obj/mime.o'
 	$(CC) -c -o $(CONFIG)/obj/mime.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/mime.c
 
 #
 #   mixed.o
 #
-DEPS_31 += $(CONFIG)/inc/bit.h
-DEPS_31 += $(CONFIG)/inc/mpr.h
+DEPS_32 += $(CONFIG)/inc/bit.h
+DEPS_32 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/mixed.o: \
-    src/mixed.c $(DEPS_31)
+    src/mixed.c $(DEPS_32)
 	@echo '   [Compile] $(CONFIG)/obj/mixed.o'
 	$(CC) -c -o $(CONFIG)/obj/mixed.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/mixed.c
 
 #
 #   module.o
 #
-DEPS_32 += $(CONFIG)/inc/bit.h
-DEPS_32 += $(CONFIG)/inc/mpr.h
+DEPS_33 += $(CONFIG)/inc/bit.h
+DEPS_33 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/module.o: \
-    src/module.c $(DEPS_32)
+    src/module.c $(DEPS_33)
 	@echo '   [Compile] $(CONFIG)/obj/module.o'
 	$(CC) -c -o $(CONFIG)/obj/module.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/module.c
 
 #
 #   mpr.o
 #
-DEPS_33 += $(CONFIG)/inc/bit.h
-DEPS_33 += $(CONFIG)/inc/mpr.h
+DEPS_34 += $(CONFIG)/inc/bit.h
+DEPS_34 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/mpr.o: \
-    src/mpr.c $(DEPS_33)
+    src/mpr.c $(DEPS_34)
 	@echo '   [Compile] $(CONFIG)/obj/mpr.o'
 	$(CC) -c -o $(CONFIG)/obj/mpr.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/mpr.c
 
 #
 #   path.o
 #
-DEPS_34 += $(CONFIG)/inc/bit.h
-DEPS_34 += $(CONFIG)/inc/mpr.h
+DEPS_35 += $(CONFIG)/inc/bit.h
+DEPS_35 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/path.o: \
-    src/path.c $(DEPS_34)
+    src/path.c $(DEPS_35)
 	@echo '   [Compile] $(CONFIG)/obj/path.o'
 	$(CC) -c -o $(CONFIG)/obj/path.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/path.c
 
 #
 #   posix.o
 #
-DEPS_35 += $(CONFIG)/inc/bit.h
-DEPS_35 += $(CONFIG)/inc/mpr.h
+DEPS_36 += $(CONFIG)/inc/bit.h
+DEPS_36 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/posix.o: \
-    src/posix.c $(DEPS_35)
+    src/posix.c $(DEPS_36)
 	@echo '   [Compile] $(CONFIG)/obj/posix.o'
 	$(CC) -c -o $(CONFIG)/obj/posix.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/posix.c
 
 #
 #   printf.o
 #
-DEPS_36 += $(CONFIG)/inc/bit.h
-DEPS_36 += $(CONFIG)/inc/mpr.h
+DEPS_37 += $(CONFIG)/inc/bit.h
+DEPS_37 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/printf.o: \
-    src/printf.c $(DEPS_36)
+    src/printf.c $(DEPS_37)
 	@echo '   [Compile] $(CONFIG)/obj/printf.o'
 	$(CC) -c -o $(CONFIG)/obj/printf.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/printf.c
 
 #
 #   rom.o
 #
-DEPS_37 += $(CONFIG)/inc/bit.h
-DEPS_37 += $(CONFIG)/inc/mpr.h
+DEPS_38 += $(CONFIG)/inc/bit.h
+DEPS_38 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/rom.o: \
-    src/rom.c $(DEPS_37)
+    src/rom.c $(DEPS_38)
 	@echo '   [Compile] $(CONFIG)/obj/rom.o'
 	$(CC) -c -o $(CONFIG)/obj/rom.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/rom.c
 
 #
 #   select.o
 #
-DEPS_38 += $(CONFIG)/inc/bit.h
-DEPS_38 += $(CONFIG)/inc/mpr.h
+DEPS_39 += $(CONFIG)/inc/bit.h
+DEPS_39 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/select.o: \
-    src/select.c $(DEPS_38)
+    src/select.c $(DEPS_39)
 	@echo '   [Compile] $(CONFIG)/obj/select.o'
 	$(CC) -c -o $(CONFIG)/obj/select.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/select.c
 
 #
 #   signal.o
 #
-DEPS_39 += $(CONFIG)/inc/bit.h
-DEPS_39 += $(CONFIG)/inc/mpr.h
+DEPS_40 += $(CONFIG)/inc/bit.h
+DEPS_40 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/signal.o: \
-    src/signal.c $(DEPS_39)
+    src/signal.c $(DEPS_40)
 	@echo '   [Compile] $(CONFIG)/obj/signal.o'
 	$(CC) -c -o $(CONFIG)/obj/signal.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/signal.c
 
 #
 #   socket.o
 #
-DEPS_40 += $(CONFIG)/inc/bit.h
-DEPS_40 += $(CONFIG)/inc/mpr.h
+DEPS_41 += $(CONFIG)/inc/bit.h
+DEPS_41 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/socket.o: \
-    src/socket.c $(DEPS_40)
+    src/socket.c $(DEPS_41)
 	@echo '   [Compile] $(CONFIG)/obj/socket.o'
 	$(CC) -c -o $(CONFIG)/obj/socket.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/socket.c
 
 #
 #   string.o
 #
-DEPS_41 += $(CONFIG)/inc/bit.h
-DEPS_41 += $(CONFIG)/inc/mpr.h
+DEPS_42 += $(CONFIG)/inc/bit.h
+DEPS_42 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/string.o: \
-    src/string.c $(DEPS_41)
+    src/string.c $(DEPS_42)
 	@echo '   [Compile] $(CONFIG)/obj/string.o'
 	$(CC) -c -o $(CONFIG)/obj/string.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/string.c
 
 #
 #   test.o
 #
-DEPS_42 += $(CONFIG)/inc/bit.h
-DEPS_42 += $(CONFIG)/inc/mpr.h
+DEPS_43 += $(CONFIG)/inc/bit.h
+DEPS_43 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/test.o: \
-    src/test.c $(DEPS_42)
+    src/test.c $(DEPS_43)
 	@echo '   [Compile] $(CONFIG)/obj/test.o'
 	$(CC) -c -o $(CONFIG)/obj/test.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/test.c
 
 #
 #   thread.o
 #
-DEPS_43 += $(CONFIG)/inc/bit.h
-DEPS_43 += $(CONFIG)/inc/mpr.h
+DEPS_44 += $(CONFIG)/inc/bit.h
+DEPS_44 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/thread.o: \
-    src/thread.c $(DEPS_43)
+    src/thread.c $(DEPS_44)
 	@echo '   [Compile] $(CONFIG)/obj/thread.o'
 	$(CC) -c -o $(CONFIG)/obj/thread.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/thread.c
 
 #
 #   time.o
 #
-DEPS_44 += $(CONFIG)/inc/bit.h
-DEPS_44 += $(CONFIG)/inc/mpr.h
+DEPS_45 += $(CONFIG)/inc/bit.h
+DEPS_45 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/time.o: \
-    src/time.c $(DEPS_44)
+    src/time.c $(DEPS_45)
 	@echo '   [Compile] $(CONFIG)/obj/time.o'
 	$(CC) -c -o $(CONFIG)/obj/time.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/time.c
 
+#
+#   uring.o
+#
+DEPS_46 += $(CONFIG)/inc/bit.h
+DEPS_46 += $(CONFIG)/inc/mpr.h
+
+$(CONFIG)/obj/uring.o: \
+    src/uring.c $(DEPS_46)
+	@echo '   [Compile] $(CONFIG)/obj/uring.o'
+	$(CC) -c -o $(CONFIG)/obj/uring.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/uring.c
+
 #
 #   vxworks.o
 #
-DEPS_45 += $(CONFIG)/inc/bit.h
-DEPS_45 += $(CONFIG)/inc/mpr.h
+DEPS_47 += $(CONFIG)/inc/bit.h
+DEPS_47 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/vxworks.o: \
-    src/vxworks.c $(DEPS_45)
+    src/vxworks.c $(DEPS_47)
 	@echo '   [Compile] $(CONFIG)/obj/vxworks.o'
 	$(CC) -c -o $(CONFIG)/obj/vxworks.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/vxworks.c
 
 #
 #   wait.o
 #
-DEPS_46 += $(CONFIG)/inc/bit.h
-DEPS_46 += $(CONFIG)/inc/mpr.h
+DEPS_48 += $(CONFIG)/inc/bit.h
+DEPS_48 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/wait.o: \
-    src/wait.c $(DEPS_46)
+    src/wait.c $(DEPS_48)
 	@echo '   [Compile] $(CONFIG)/obj/wait.o'
 	$(CC) -c -o $(CONFIG)/obj/wait.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/wait.c
 
 #
 #   wide.o
 #
-DEPS_47 += $(CONFIG)/inc/bit.h
-DEPS_47 += $(CONFIG)/inc/mpr.h
+DEPS_49 += $(CONFIG)/inc/bit.h
+DEPS_49 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/wide.o: \
-    src/wide.c $(DEPS_47)
+    src/wide.c $(DEPS_49)
 	@echo '   [Compile] $(CONFIG)/obj/wide.o'
 	$(CC) -c -o $(CONFIG)/obj/wide.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/wide.c
 
 #
 #   win.o
 #
-DEPS_48 += $(CONFIG)/inc/bit.h
-DEPS_48 += $(CONFIG)/inc/mpr.h
+DEPS_50 += $(CONFIG)/inc/bit.h
+DEPS_50 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/win.o: \
-    src/win.c $(DEPS_48)
+    src/win.c $(DEPS_50)
 	@echo '   [Compile] $(CONFIG)/obj/win.o'
 	$(CC) -c -o $(CONFIG)/obj/win.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/win.c
 
 #
 #   wince.o
 #
-DEPS_49 += $(CONFIG)/inc/bit.h
-DEPS_49 += $(CONFIG)/inc/mpr.h
+DEPS_51 += $(CONFIG)/inc/bit.h
+DEPS_51 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/wince.o: \
-    src/wince.c $(DEPS_49)
+    src/wince.c $(DEPS_51)
 	@echo '   [Compile] $(CONFIG)/obj/wince.o'
 	$(CC) -c -o $(CONFIG)/obj/wince.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/wince.c
 
 #
 #   xml.o
 #
-DEPS_50 += $(CONFIG)/inc/bit.h
-DEPS_50 += $(CONFIG)/inc/mpr.h
+DEPS_52 += $(CONFIG)/inc/bit.h
+DEPS_52 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/xml.o: \
-    src/xml.c $(DEPS_50)
+    src/xml.c $(DEPS_52)
 	@echo '   [Compile] $(CONFIG)/obj/xml.o'
 	$(CC) -c -o $(CONFIG)/obj/xml.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/xml.c
 
 #
 #   libmpr
 #
-DEPS_51 += $(CONFIG)/inc/bit.h
-DEPS_51 += $(CONFIG)/inc/bitos.h
-DEPS_51 += $(CONFIG)/inc/mpr.h
-DEPS_51 += $(CONFIG)/obj/async.o
-DEPS_51 += $(CONFIG)/obj/atomic.o
-DEPS_51 += $(CONFIG)/obj/buf.o
-DEPS_51 += $(CONFIG)/obj/cache.o
-DEPS_51 += $(CONFIG)/obj/cmd.o
-DEPS_51 += $(CONFIG)/obj/cond.o
-DEPS_51 += $(CONFIG)/obj/crypt.o
-DEPS_51 += $(CONFIG)/obj/disk.o
-DEPS_51 += $(CONFIG)/obj/dispatcher.o
-DEPS_51 += $(CONFIG)/obj/encode.o
-DEPS_51 += $(CONFIG)/obj/epoll.o
-DEPS_51 += $(CONFIG)/obj/event.o
-DEPS_51 += $(CONFIG)/obj/file.o
-DEPS_51 += $(CONFIG)/obj/fs.o
-DEPS_51 += $(CONFIG)/obj/hash.o
-DEPS_51 += $(CONFIG)/obj/json.o
-DEPS_51 += $(CONFIG)/obj/kqueue.o
-DEPS_51 += $(CONFIG)/obj/list.o
-DEPS_51 += $(CONFIG)/obj/lock.o
-DEPS_51 += $(CONFIG)/obj/log.o
-DEPS_51 += $(CONFIG)/obj/mem.o
-DEPS_51 += $(CONFIG)/obj/mime.o
-DEPS_51 += $(CONFIG)/obj/mixed.o
-DEPS_51 += $(CONFIG)/obj/module.o
-DEPS_51 += $(CONFIG)/obj/mpr.o
-DEPS_51 += $(CONFIG)/obj/path.o
-DEPS_51 += $(CONFIG)/obj/posix.o
-DEPS_51 += $(CONFIG)/obj/printf.o
-DEPS_51 += $(CONFIG)/obj/rom.o
-DEPS_51 += $(CONFIG)/obj/select.o
-DEPS_51 += $(CONFIG)/obj/signal.o
-DEPS_51 += $(CONFIG)/obj/socket.o
-DEPS_51 += $(CONFIG)/obj/string.o
-DEPS_51 += $(CONFIG)/obj/test.o
-DEPS_51 += $(CONFIG)/obj/thread.o
-DEPS_51 += $(CONFIG)/obj/time.o
-DEPS_51 += $(CONFIG)/obj/vxworks.o
-DEPS_51 += $(CONFIG)/obj/wait.o
-DEPS_51 += $(CONFIG)/obj/wide.o
-DEPS_51 += $(CONFIG)/obj/win.o
-DEPS_51 += $(CONFIG)/obj/wince.o
-DEPS_51 += $(CONFIG)/obj/xml.o
-
-$(CONFIG)/bin/libmpr.dylib: $(DEPS_51)
-	@echo '      [Link] $(CONFIG)/bin/libmpr.dylib'
-	$(CC) -dynamiclib -o $(CONFIG)/bin/libmpr.dylib -arch $(CC_ARCH) $(LDFLAGS) $(LIBPATHS) -install_name @rpath/libmpr.dylib -compatibility_version 4.4.0 -current_version 4.4.0 "$(CONFIG)/obj/async.o" "$(CONFIG)/obj/atomic.o" "$(CONFIG)/obj/buf.o" "$(CONFIG)/obj/cache.o" "$(CONFIG)/obj/cmd.o" "$(CONFIG)/obj/cond.o" "$(CONFIG)/obj/crypt.o" "$(CONFIG)/obj/disk.o" "$(CONFIG)/obj/dispatcher.o" "$(CONFIG)/obj/encode.o" "$(CONFIG)/obj/epoll.o" "$(CONFIG)/obj/event.o" "$(CONFIG)/obj/file.o" "$(CONFIG)/obj/fs.o" "$(CONFIG)/obj/hash.o" "$(CONFIG)/obj/json.o" "$(CONFIG)/obj/kqueue.o" "$(CONFIG)/obj/list.o" "$(CONFIG)/obj/lock.o" "$(CONFIG)/obj/log.o" "$(CONFIG)/obj/mem.o" "$(CONFIG)/obj/mime.o" "$(CONFIG)/obj/mixed.o" "$(CONFIG)/obj/module.o" "$(CONFIG)/obj/mpr.o" "$(CONFIG)/obj/path.o" "$(CONFIG)/obj/posix.o" "$(CONFIG)/obj/printf.o" "$(CONFIG)/obj/rom.o" "$(CONFIG)/obj/select.o" "$(CONFIG)/obj/signal.o" "$(CONFIG)/obj/socket.o" "$(CONFIG)/obj/string.o" "$(CONFIG)/obj/test.o" "$(CONFIG)/obj/thread.o" "$(CONFIG)/obj/time.o" "$(CONFIG)/obj/vxworks.o" "$(CONFIG)/obj/wait.o" "$(CONFIG)/obj/wide.o" "$(CONFIG)/obj/win.o" "$(CONFIG)/obj/wince.o" "$(CONFIG)/obj/xml.o" $(LIBS) 
-
-#
-#   benchMpr.o
-#
-DEPS_52 += $(CONFIG)/inc/bit.h
-DEPS_52 += $(CONFIG)/inc/mpr.h
-
-$(CONFIG)/obj/benchMpr.o: \
-    test/benchMpr.c $(DEPS_52)
-	@echo '   [Compile] $(CONFIG)/obj/benchMpr.o'
-	$(CC) -c -o $(CONFIG)/obj/benchMpr.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/benchMpr.c
-
-#
-#   benchMpr
-#
 DEPS_53 += $(CONFIG)/inc/bit.h
 DEPS_53 += $(CONFIG)/inc/bitos.h
 DEPS_53 += $(CONFIG)/inc/mpr.h
@@ -838,6 +798,7 @@ DEPS_53 += $(CONFIG)/obj/dispatcher.o
 DEPS_53 += $(CONFIG)/obj/encode.o
 DEPS_53 += $(CONFIG)/obj/epoll.o
 DEPS_53 += $(CONFIG)/obj/event.o
+DEPS_53 += $(CONFIG)/obj/fiber.o
 DEPS_53 += $(CONFIG)/obj/file.o
 DEPS_53 += $(CONFIG)/obj/fs.o
 DEPS_53 += $(CONFIG)/obj/hash.o
@@ -862,470 +823,443 @@ DEPS_53 += $(CONFIG)/obj/string.o
 DEPS_53 += $(CONFIG)/obj/test.o
 DEPS_53 += $(CONFIG)/obj/thread.o
 DEPS_53 += $(CONFIG)/obj/time.o
+DEPS_53 += $(CONFIG)/obj/uring.o
 DEPS_53 += $(CONFIG)/obj/vxworks.o
 DEPS_53 += $(CONFIG)/obj/wait.o
 DEPS_53 += $(CONFIG)/obj/wide.o
 DEPS_53 += $(CONFIG)/obj/win.o
 DEPS_53 += $(CONFIG)/obj/wince.o
 DEPS_53 += $(CONFIG)/obj/xml.o
-DEPS_53 += $(CONFIG)/bin/libmpr.dylib
-DEPS_53 += $(CONFIG)/obj/benchMpr.o
+
+$(CONFIG)/bin/libmpr.dylib: $(DEPS_53)
+	@echo '      [Link] $(CONFIG)/bin/libmpr.dylib'
+	$(CC) -dynamiclib -o $(CONFIG)/bin/libmpr.dylib -arch $(CC_ARCH) $(LDFLAGS) $(LIBPATHS) -install_name @rpath/libmpr.dylib -compatibility_version 4.4.0 -current_version 4.4.0 "$(CONFIG)/obj/async.o" "$(CONFIG)/obj/atomic.o" "$(CONFIG)/obj/buf.o" "$(CONFIG)/obj/cache.o" "$(CONFIG)/obj/cmd.o" "$(CONFIG)/obj/cond.o" "$(CONFIG)/obj/crypt.o" "$(CONFIG)/obj/disk.o" "$(CONFIG)/obj/dispatcher.o" "$(CONFIG)/obj/encode.o" "$(CONFIG)/obj/epoll.o" "$(CONFIG)/obj/event.o" "$(CONFIG)/obj/fiber.o" "$(CONFIG)/obj/file.o" "$(CONFIG)/obj/fs.o" "$(CONFIG)/obj/hash.o" "$(CONFIG)/obj/json.o" "$(CONFIG)/obj/kqueue.o" "$(CONFIG)/obj/list.o" "$(CONFIG)/obj/lock.o" "$(CONFIG)/obj/log.o" "$(CONFIG)/obj/mem.o" "$(CONFIG)/obj/mime.o" "$(CONFIG)/obj/mixed.o" "$(CONFIG)/obj/module.o" "$(CONFIG)/obj/mpr.o" "$(CONFIG)/obj/path.o" "$(CONFIG)/obj/posix.o" "$(CONFIG)/obj/printf.o" "$(CONFIG)/obj/rom.o" "$(CONFIG)/obj/select.o" "$(CONFIG)/obj/signal.o" "$(CONFIG)/obj/socket.o" "$(CONFIG)/obj/string.o" "$(CONFIG)/obj/test.o" "$(CONFIG)/obj/thread.o" "$(CONFIG)/obj/time.o" "$(CONFIG)/obj/uring.o" "$(CONFIG)/obj/vxworks.o" "$(CONFIG)/obj/wait.o" "$(CONFIG)/obj/wide.o" "$(CONFIG)/obj/win.o" "$(CONFIG)/obj/wince.o" "$(CONFIG)/obj/xml.o" $(LIBS) 
+
+#
+#   benchMpr.o
+#
+DEPS_54 += $(CONFIG)/inc/bit.h
+DEPS_54 += $(CONFIG)/inc/mpr.h
+
+$(CONFIG)/obj/benchMpr.o: \
+    test/benchMpr.c $(DEPS_54)
+	@echo '   [Compile] $(CONFIG)/obj/benchMpr.o'
+	$(CC) -c -o $(CONFIG)/obj/benchMpr.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/benchMpr.c
+
+#
+#   benchMpr
+#
+DEPS_55 += $(CONFIG)/inc/bit.h
+DEPS_55 += $(CONFIG)/inc/bitos.h
+DEPS_55 += $(CONFIG)/inc/mpr.h
+DEPS_55 += $(CONFIG)/obj/async.o
+DEPS_55 += $(CONFIG)/obj/atomic.o
+DEPS_55 += $(CONFIG)/obj/buf.o
+DEPS_55 += $(CONFIG)/obj/cache.o
+DEPS_55 += $(CONFIG)/obj/cmd.o
+DEPS_55 += $(CONFIG)/obj/cond.o
+DEPS_55 += $(CONFIG)/obj/crypt.o
+DEPS_55 += $(CONFIG)/obj/disk.o
+DEPS_55 += $(CONFIG)/obj/dispatcher.o
+DEPS_55 += $(CONFIG)/obj/encode.o
+DEPS_55 += $(CONFIG)/obj/epoll.o
+DEPS_55 += $(CONFIG)/obj/event.o
+DEPS_55 += $(CONFIG)/obj/fiber.o
+DEPS_55 += $(CONFIG)/obj/file.o
+DEPS_55 += $(CONFIG)/obj/fs.o
+DEPS_55 += $(CONFIG)/obj/hash.o
+DEPS_55 += $(CONFIG)/obj/json.o
+DEPS_55 += $(CONFIG)/obj/kqueue.o
+DEPS_55 += $(CONFIG)/obj/list.o
+DEPS_55 += $(CONFIG)/obj/lock.o
+DEPS_55 += $(CONFIG)/obj/log.o
+DEPS_55 += $(CONFIG)/obj/mem.o
+DEPS_55 += $(CONFIG)/obj/mime.o
+DEPS_55 += $(CONFIG)/obj/mixed.o
+DEPS_55 += $(CONFIG)/obj/module.o
+DEPS_55 += $(CONFIG)/obj/mpr.o
+DEPS_55 += $(CONFIG)/obj/path.o
+DEPS_55 += $(CONFIG)/obj/posix.o
+DEPS_55 += $(CONFIG)/obj/printf.o
+DEPS_55 += $(CONFIG)/obj/rom.o
+DEPS_55 += $(CONFIG)/obj/select.o
+DEPS_55 += $(CONFIG)/obj/signal.o
+DEPS_55 += $(CONFIG)/obj/socket.o
+DEPS_55 += $(CONFIG)/obj/string.o
+DEPS_55 += $(CONFIG)/obj/test.o
+DEPS_55 += $(CONFIG)/obj/thread.o
+DEPS_55 += $(CONFIG)/obj/time.o
+DEPS_55 += $(CONFIG)/obj/uring.o
+DEPS_55 += $(CONFIG)/obj/vxworks.o
+DEPS_55 += $(CONFIG)/obj/wait.o
+DEPS_55 += $(CONFIG)/obj/wide.o
+DEPS_55 += $(CONFIG)/obj/win.o
+DEPS_55 += $(CONFIG)/obj/wince.o
+DEPS_55 += $(CONFIG)/obj/xml.o
+DEPS_55 += $(CONFIG)/bin/libmpr.dylib
+DEPS_55 += $(CONFIG)/obj/benchMpr.o
 
 LIBS_53 += -lmpr
 
-$(CONFIG)/bin/benchMpr: $(DEPS_53)
+$(CONFIG)/bin/benchMpr: $(DEPS_55)
 	@echo '      [Link] $(CONFIG)/bin/benchMpr'
 	$(CC) -o $(CONFIG)/bin/benchMpr -arch $(CC_ARCH) $(LDFLAGS) $(LIBPATHS) "$(CONFIG)/obj/benchMpr.o" $(LIBPATHS_53) $(LIBS_53) $(LIBS_53) $(LIBS) 
 
 #
 #   runProgram.o
 #
-DEPS_54 += $(CONFIG)/inc/bit.h
+DEPS_56 += $(CONFIG)/inc/bit.h
 
 $(CONFIG)/obj/runProgram.o: \
-    test/runProgram.c $(DEPS_54)
+    test/runProgram.c $(DEPS_56)
 	@echo '   [Compile] $(CONFIG)/obj/runProgram.o'
 	$(CC) -c -o $(CONFIG)/obj/runProgram.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/runProgram.c
 
 #
 #   runProgram
 #
-DEPS_55 += $(CONFIG)/inc/bit.h
-DEPS_55 += $(CONFIG)/obj/runProgram.o
+DEPS_57 += $(CONFIG)/inc/bit.h
+DEPS_57 += $(CONFIG)/obj/runProgram.o
 
-$(CONFIG)/bin/runProgram: $(DEPS_55)
+$(CONFIG)/bin/runProgram: $(DEPS_57)
 	@echo '      [Link] $(CONFIG)/bin/runProgram'
 	$(CC) -o $(CONFIG)/bin/runProgram -arch $(CC_ARCH) $(LDFLAGS) $(LIBPATHS) "$(CONFIG)/obj/runProgram.o" $(LIBS) 
 
 #
 #   testArgv.o
 #
-DEPS_56 += $(CONFIG)/inc/bit.h
-DEPS_56 += $(CONFIG)/inc/mpr.h
+DEPS_58 += $(CONFIG)/inc/bit.h
+DEPS_58 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testArgv.o: \
-    test/testArgv.c $(DEPS_56)
+    test/testArgv.c $(DEPS_58)
 	@echo '   [Compile] $(CONFIG)/obj/testArgv.o'
 	$(CC) -c -o $(CONFIG)/obj/testArgv.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testArgv.c
 
 #
 #   testAtomic.o
 #
-DEPS_57 += $(CONFIG)/inc/bit.h
-DEPS_57 += $(CONFIG)/inc/mpr.h
+DEPS_59 += $(CONFIG)/inc/bit.h
+DEPS_59 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testAtomic.o: \
-    test/testAtomic.c $(DEPS_57)
+    test/testAtomic.c $(DEPS_59)
 	@echo '   [Compile] $(CONFIG)/obj/testAtomic.o'
 	$(CC) -c -o $(CONFIG)/obj/testAtomic.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testAtomic.c
 
 #
 #   testBuf.o
 #
-DEPS_58 += $(CONFIG)/inc/bit.h
-DEPS_58 += $(CONFIG)/inc/mpr.h
+DEPS_60 += $(CONFIG)/inc/bit.h
+DEPS_60 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testBuf.o: \
-    test/testBuf.c $(DEPS_58)
+    test/testBuf.c $(DEPS_60)
 	@echo '   [Compile] $(CONFIG)/obj/testBuf.o'
 	$(CC) -c -o $(CONFIG)/obj/testBuf.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testBuf.c
 
 #
 #   testCmd.o
 #
-DEPS_59 += $(CONFIG)/inc/bit.h
-DEPS_59 += $(CONFIG)/inc/mpr.h
+DEPS_61 += $(CONFIG)/inc/bit.h
+DEPS_61 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testCmd.o: \
-    test/testCmd.c $(DEPS_59)
+    test/testCmd.c $(DEPS_61)
 	@echo '   [Compile] $(CONFIG)/obj/testCmd.o'
 	$(CC) -c -o $(CONFIG)/obj/testCmd.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testCmd.c
 
 #
 #   testCond.o
 #
-DEPS_60 += $(CONFIG)/inc/bit.h
-DEPS_60 += $(CONFIG)/inc/mpr.h
+DEPS_62 += $(CONFIG)/inc/bit.h
+DEPS_62 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testCond.o: \
-    test/testCond.c $(DEPS_60)
+    test/testCond.c $(DEPS_62)
 	@echo '   [Compile] $(CONFIG)/obj/testCond.o'
 	$(CC) -c -o $(CONFIG)/obj/testCond.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testCond.c
 
 #
 #   testEvent.o
 #
-DEPS_61 += $(CONFIG)/inc/bit.h
-DEPS_61 += $(CONFIG)/inc/mpr.h
+DEPS_63 += $(CONFIG)/inc/bit.h
+DEPS_63 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testEvent.o: \
-    test/testEvent.c $(DEPS_61)
+    test/testEvent.c $(DEPS_63)
 	@echo '   [Compile] $(CONFIG)/obj/testEvent.o'
 	$(CC) -c -o $(CONFIG)/obj/testEvent.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testEvent.c
 
 #
 #   testFile.o
 #
-DEPS_62 += $(CONFIG)/inc/bit.h
-DEPS_62 += $(CONFIG)/inc/mpr.h
+DEPS_64 += $(CONFIG)/inc/bit.h
+DEPS_64 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testFile.o: \
-    test/testFile.c $(DEPS_62)
+    test/testFile.c $(DEPS_64)
 	@echo '   [Compile] $(CONFIG)/obj/testFile.o'
 	$(CC) -c -o $(CONFIG)/obj/testFile.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testFile.c
 
 #
 #   testHash.o
 #
-DEPS_63 += $(CONFIG)/inc/bit.h
-DEPS_63 += $(CONFIG)/inc/mpr.h
+DEPS_65 += $(CONFIG)/inc/bit.h
+DEPS_65 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testHash.o: \
-    test/testHash.c $(DEPS_63)
+    test/testHash.c $(DEPS_65)
 	@echo '   [Compile] $(CONFIG)/obj/testHash.o'
 	$(CC) -c -o $(CONFIG)/obj/testHash.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testHash.c
 
 #
 #   testList.o
 #
-DEPS_64 += $(CONFIG)/inc/bit.h
-DEPS_64 += $(CONFIG)/inc/mpr.h
+DEPS_66 += $(CONFIG)/inc/bit.h
+DEPS_66 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testList.o: \
-    test/testList.c $(DEPS_64)
+    test/testList.c $(DEPS_66)
 	@echo '   [Compile] $(CONFIG)/obj/testList.o'
 	$(CC) -c -o $(CONFIG)/obj/testList.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testList.c
 
 #
 #   testLock.o
 #
-DEPS_65 += $(CONFIG)/inc/bit.h
-DEPS_65 += $(CONFIG)/inc/mpr.h
+DEPS_67 += $(CONFIG)/inc/bit.h
+DEPS_67 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testLock.o: \
-    test/testLock.c $(DEPS_65)
+    test/testLock.c $(DEPS_67)
 	@echo '   [Compile] $(CONFIG)/obj/testLock.o'
 	$(CC) -c -o $(CONFIG)/obj/testLock.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testLock.c
 
 #
 #   testMem.o
 #
-DEPS_66 += $(CONFIG)/inc/bit.h
-DEPS_66 += $(CONFIG)/inc/mpr.h
+DEPS_68 += $(CONFIG)/inc/bit.h
+DEPS_68 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testMem.o: \
-    test/testMem.c $(DEPS_66)
+    test/testMem.c $(DEPS_68)
 	@echo '   [Compile] $(CONFIG)/obj/testMem.o'
 	$(CC) -c -o $(CONFIG)/obj/testMem.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testMem.c
 
 #
 #   testMpr.o
 #
-DEPS_67 += $(CONFIG)/inc/bit.h
-DEPS_67 += $(CONFIG)/inc/mpr.h
+DEPS_69 += $(CONFIG)/inc/bit.h
+DEPS_69 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testMpr.o: \
-    test/testMpr.c $(DEPS_67)
+    test/testMpr.c $(DEPS_69)
 	@echo '   [Compile] $(CONFIG)/obj/testMpr.o'
 	$(CC) -c -o $(CONFIG)/obj/testMpr.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testMpr.c
 
 #
 #   testPath.o
 #
-DEPS_68 += $(CONFIG)/inc/bit.h
-DEPS_68 += $(CONFIG)/inc/mpr.h
+DEPS_70 += $(CONFIG)/inc/bit.h
+DEPS_70 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testPath.o: \
-    test/testPath.c $(DEPS_68)
+    test/testPath.c $(DEPS_70)
 	@echo '   [Compile] $(CONFIG)/obj/testPath.o'
 	$(CC) -c -o $(CONFIG)/obj/testPath.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testPath.c
 
 #
 #   testSocket.o
 #
-DEPS_69 += $(CONFIG)/inc/bit.h
-DEPS_69 += $(CONFIG)/inc/mpr.h
+DEPS_71 += $(CONFIG)/inc/bit.h
+DEPS_71 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testSocket.o: \
-    test/testSocket.c $(DEPS_69)
+    test/testSocket.c $(DEPS_71)
 	@echo '   [Compile] $(CONFIG)/obj/testSocket.o'
 	$(CC) -c -o $(CONFIG)/obj/testSocket.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testSocket.c
 
 #
 #   testSprintf.o
 #
-DEPS_70 += $(CONFIG)/inc/bit.h
-DEPS_70 += $(CONFIG)/inc/mpr.h
+DEPS_72 += $(CONFIG)/inc/bit.h
+DEPS_72 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testSprintf.o: \
-    test/testSprintf.c $(DEPS_70)
+    test/testSprintf.c $(DEPS_72)
 	@echo '   [Compile] $(CONFIG)/obj/testSprintf.o'
 	$(CC) -c -o $(CONFIG)/obj/testSprintf.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testSprintf.c
 
 #
 #   testThread.o
 #
-DEPS_71 += $(CONFIG)/inc/bit.h
-DEPS_71 += $(CONFIG)/inc/mpr.h
+DEPS_73 += $(CONFIG)/inc/bit.h
+DEPS_73 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testThread.o: \
-    test/testThread.c $(DEPS_71)
+    test/testThread.c $(DEPS_73)
 	@echo '   [Compile] $(CONFIG)/obj/testThread.o'
 	$(CC) -c -o $(CONFIG)/obj/testThread.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testThread.c
 
 #
 #   testTime.o
 #
-DEPS_72 += $(CONFIG)/inc/bit.h
-DEPS_72 += $(CONFIG)/inc/mpr.h
+DEPS_74 += $(CONFIG)/inc/bit.h
+DEPS_74 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testTime.o: \
-    test/testTime.c $(DEPS_72)
+    test/testTime.c $(DEPS_74)
 	@echo '   [Compile] $(CONFIG)/obj/testTime.o'
 	$(CC) -c -o $(CONFIG)/obj/testTime.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testTime.c
 
 #
 #   testUnicode.o
 #
-DEPS_73 += $(CONFIG)/inc/bit.h
-DEPS_73 += $(CONFIG)/inc/mpr.h
+DEPS_75 += $(CONFIG)/inc/bit.h
+DEPS_75 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/testUnicode.o: \
-    test/testUnicode.c $(DEPS_73)
+    test/testUnicode.c $(DEPS_75)
 	@echo '   [Compile] $(CONFIG)/obj/testUnicode.o'
 	$(CC) -c -o $(CONFIG)/obj/testUnicode.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" test/testUnicode.c
 
 #
 #   testMpr
 #
-DEPS_74 += $(CONFIG)/inc/bit.h
-DEPS_74 += $(CONFIG)/inc/bitos.h
-DEPS_74 += $(CONFIG)/inc/mpr.h
-DEPS_74 += $(CONFIG)/obj/async.o
-DEPS_74 += $(CONFIG)/obj/atomic.o
-DEPS_74 += $(CONFIG)/obj/buf.o
-DEPS_74 += $(CONFIG)/obj/cache.o
-DEPS_74 += $(CONFIG)/obj/cmd.o
-DEPS_74 += $(CONFIG)/obj/cond.o
-DEPS_74 += $(CONFIG)/obj/crypt.o
-DEPS_74 += $(CONFIG)/obj/disk.o
-DEPS_74 += $(CONFIG)/obj/dispatcher.o
-DEPS_74 += $(CONFIG)/obj/encode.o
-DEPS_74 += $(CONFIG)/obj/epoll.o
-DEPS_74 += $(CONFIG)/obj/event.o
-DEPS_74 += $(CONFIG)/obj/file.o
-DEPS_74 += $(CONFIG)/obj/fs.o
-DEPS_74 += $(CONFIG)/obj/hash.o
-DEPS_74 += $(CONFIG)/obj/json.o
-DEPS_74 += $(CONFIG)/obj/kqueue.o
-DEPS_74 += $(CONFIG)/obj/list.o
-DEPS_74 += $(CONFIG)/obj/lock.o
-DEPS_74 += $(CONFIG)/obj/log.o
-DEPS_74 += $(CONFIG)/obj/mem.o
-DEPS_74 += $(CONFIG)/obj/mime.o
-DEPS_74 += $(CONFIG)/obj/mixed.o
-DEPS_74 += $(CONFIG)/obj/module.o
-DEPS_74 += $(CONFIG)/obj/mpr.o
-DEPS_74 += $(CONFIG)/obj/path.o
-DEPS_74 += $(CONFIG)/obj/posix.o
-DEPS_74 += $(CONFIG)/obj/printf.o
-DEPS_74 += $(CONFIG)/obj/rom.o
-DEPS_74 += $(CONFIG)/obj/select.o
-DEPS_74 += $(CONFIG)/obj/signal.o
-DEPS_74 += $(CONFIG)/obj/socket.o
-DEPS_74 += $(CONFIG)/obj/string.o
-DEPS_74 += $(CONFIG)/obj/test.o
-DEPS_74 += $(CONFIG)/obj/thread.o
-DEPS_74 += $(CONFIG)/obj/time.o
-DEPS_74 += $(CONFIG)/obj/vxworks.o
-DEPS_74 += $(CONFIG)/obj/wait.o
-DEPS_74 += $(CONFIG)/obj/wide.o
-DEPS_74 += $(CONFIG)/obj/win.o
-DEPS_74 += $(CONFIG)/obj/wince.o
-DEPS_74 += $(CONFIG)/obj/xml.o
-DEPS_74 += $(CONFIG)/bin/libmpr.dylib
-DEPS_74 += $(CONFIG)/obj/runProgram.o
-DEPS_74 += $(CONFIG)/bin/runProgram
-DEPS_74 += $(CONFIG)/obj/testArgv.o
-DEPS_74 += $(CONFIG)/obj/testAtomic.o
-DEPS_74 += $(CONFIG)/obj/testBuf.o
-DEPS_74 += $(CONFIG)/obj/testCmd.o
-DEPS_74 += $(CONFIG)/obj/testCond.o
-DEPS_74 += $(CONFIG)/obj/testEvent.o
-DEPS_74 += $(CONFIG)/obj/testFile.o
-DEPS_74 += $(CONFIG)/obj/testHash.o
-DEPS_74 += $(CONFIG)/obj/testList.o
-DEPS_74 += $(CONFIG)/obj/testLock.o
-DEPS_74 += $(CONFIG)/obj/testMem.o
-DEPS_74 += $(CONFIG)/obj/testMpr.o
-DEPS_74 += $(CONFIG)/obj/testPath.o
-DEPS_74 += $(CONFIG)/obj/testSocket.o
-DEPS_74 += $(CONFIG)/obj/testSprintf.o
-DEPS_74 += $(CONFIG)/obj/testThread.o
-DEPS_74 += $(CONFIG)/obj/testTime.o
-DEPS_74 += $(CONFIG)/obj/testUnicode.o
+DEPS_76 += $(CONFIG)/inc/bit.h
+DEPS_76 += $(CONFIG)/inc/bitos.h
+DEPS_76 += $(CONFIG)/inc/mpr.h
+DEPS_76 += $(CONFIG)/obj/async.o
+DEPS_76 += $(CONFIG)/obj/atomic.o
+DEPS_76 += $(CONFIG)/obj/buf.o
+DEPS_76 += $(CONFIG)/obj/cache.o
+DEPS_76 += $(CONFIG)/obj/cmd.o
+DEPS_76 += $(CONFIG)/obj/cond.o
+DEPS_76 += $(CONFIG)/obj/crypt.o
+DEPS_76 += $(CONFIG)/obj/disk.o
+DEPS_76 += $(CONFIG)/obj/dispatcher.o
+DEPS_76 += $(CONFIG)/obj/encode.o
+DEPS_76 += $(CONFIG)/obj/epoll.o
+DEPS_76 += $(CONFIG)/obj/event.o
+DEPS_76 += $(CONFIG)/obj/fiber.o
+DEPS_76 += $(CONFIG)/obj/file.o
+DEPS_76 += $(CONFIG)/obj/fs.o
+DEPS_76 += $(CONFIG)/obj/hash.o
+DEPS_76 += $(CONFIG)/obj/json.o
+DEPS_76 += $(CONFIG)/obj/kqueue.o
+DEPS_76 += $(CONFIG)/obj/list.o
+DEPS_76 += $(CONFIG)/obj/lock.o
+DEPS_76 += $(CONFIG)/obj/log.o
+DEPS_76 += $(CONFIG)/obj/mem.o
+DEPS_76 += $(CONFIG)/obj/mime.o
+DEPS_76 += $(CONFIG)/obj/mixed.o
+DEPS_76 += $(CONFIG)/obj/module.o
+DEPS_76 += $(CONFIG)/obj/mpr.o
+DEPS_76 += $(CONFIG)/obj/path.o
+DEPS_76 += $(CONFIG)/obj/posix.o
+DEPS_76 += $(CONFIG)/obj/printf.o
+DEPS_76 += $(CONFIG)/obj/rom.o
+DEPS_76 += $(CONFIG)/obj/select.o
+DEPS_76 += $(CONFIG)/obj/signal.o
+DEPS_76 += $(CONFIG)/obj/socket.o
+DEPS_76 += $(CONFIG)/obj/string.o
+DEPS_76 += $(CONFIG)/obj/test.o
+DEPS_76 += $(CONFIG)/obj/thread.o
+DEPS_76 += $(CONFIG)/obj/time.o
+DEPS_76 += $(CONFIG)/obj/uring.o
+DEPS_76 += $(CONFIG)/obj/vxworks.o
+DEPS_76 += $(CONFIG)/obj/wait.o
+DEPS_76 += $(CONFIG)/obj/wide.o
+DEPS_76 += $(CONFIG)/obj/win.o
+DEPS_76 += $(CONFIG)/obj/wince.o
+DEPS_76 += $(CONFIG)/obj/xml.o
+DEPS_76 += $(CONFIG)/bin/libmpr.dylib
+DEPS_76 += $(CONFIG)/obj/runProgram.o
+DEPS_76 += $(CONFIG)/bin/runProgram
+DEPS_76 += $(CONFIG)/obj/testArgv.o
+DEPS_76 += $(CONFIG)/obj/testAtomic.o
+DEPS_76 += $(CONFIG)/obj/testBuf.o
+DEPS_76 += $(CONFIG)/obj/testCmd.o
+DEPS_76 += $(CONFIG)/obj/testCond.o
+DEPS_76 += $(CONFIG)/obj/testEvent.o
+DEPS_76 += $(CONFIG)/obj/testFile.o
+DEPS_76 += $(CONFIG)/obj/testHash.o
+DEPS_76 += $(CONFIG)/obj/testList.o
+DEPS_76 += $(CONFIG)/obj/testLock.o
+DEPS_76 += $(CONFIG)/obj/testMem.o
+DEPS_76 += $(CONFIG)/obj/testMpr.o
+DEPS_76 += $(CONFIG)/obj/testPath.o
+DEPS_76 += $(CONFIG)/obj/testSocket.o
+DEPS_76 += $(CONFIG)/obj/testSprintf.o
+DEPS_76 += $(CONFIG)/obj/testThread.o
+DEPS_76 += $(CONFIG)/obj/testTime.o
+DEPS_76 += $(CONFIG)/obj/testUnicode.o
 
 LIBS_74 += -lmpr
 
-$(CONFIG)/bin/testMpr: $(DEPS_74)
+$(CONFIG)/bin/testMpr: $(DEPS_76)
 	@echo '      [Link] $(CONFIG)/bin/testMpr'
 	$(CC) -o $(CONFIG)/bin/testMpr -arch $(CC_ARCH) $(LDFLAGS) $(LIBPATHS) "$(CONFIG)/obj/testArgv.o" "$(CONFIG)/obj/testAtomic.o" "$(CONFIG)/obj/testBuf.o" "$(CONFIG)/obj/testCmd.o" "$(CONFIG)/obj/testCond.o" "$(CONFIG)/obj/testEvent.o" "$(CONFIG)/obj/testFile.o" "$(CONFIG)/obj/testHash.o" "$(CONFIG)/obj/testList.o" "$(CONFIG)/obj/testLock.o" "$(CONFIG)/obj/testMem.o" "$(CONFIG)/obj/testMpr.o" "$(CONFIG)/obj/testPath.o" "$(CONFIG)/obj/testSocket.o" "$(CONFIG)/obj/testSprintf.o" "$(CONFIG)/obj/testThread.o" "$(CONFIG)/obj/testTime.o" "$(CONFIG)/obj/testUnicode.o" $(LIBPATHS_74) $(LIBS_74) $(LIBS_74) $(LIBS) 
 
 #
 #   est.o
 #
-DEPS_75 += $(CONFIG)/inc/bit.h
-DEPS_75 += $(CONFIG)/inc/mpr.h
-DEPS_75 += $(CONFIG)/inc/est.h
+DEPS_77 += $(CONFIG)/inc/bit.h
+DEPS_77 += $(CONFIG)/inc/mpr.h
+DEPS_77 += $(CONFIG)/inc/est.h
 
 $(CONFIG)/obj/est.o: \
-    src/ssl/est.c $(DEPS_75)
+    src/ssl/est.c $(DEPS_77)
 	@echo '   [Compile] $(CONFIG)/obj/est.o'
 	$(CC) -c -o $(CONFIG)/obj/est.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" "-I$(BIT_PACK_MATRIXSSL_PATH)" "-I$(BIT_PACK_MATRIXSSL_PATH)/matrixssl" "-I$(BIT_PACK_NANOSSL_PATH)/src" "-I$(BIT_PACK_OPENSSL_PATH)/include" src/ssl/est.c
 
 #
 #   matrixssl.o
 #
-DEPS_76 += $(CONFIG)/inc/bit.h
-DEPS_76 += $(CONFIG)/inc/mpr.h
+DEPS_78 += $(CONFIG)/inc/bit.h
+DEPS_78 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/matrixssl.o: \
-    src/ssl/matrixssl.c $(DEPS_76)
+    src/ssl/matrixssl.c $(DEPS_78)
 	@echo '   [Compile] $(CONFIG)/obj/matrixssl.o'
 	$(CC) -c -o $(CONFIG)/obj/matrixssl.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" "-I$(BIT_PACK_MATRIXSSL_PATH)" "-I$(BIT_PACK_MATRIXSSL_PATH)/matrixssl" "-I$(BIT_PACK_NANOSSL_PATH)/src" "-I$(BIT_PACK_OPENSSL_PATH)/include" src/ssl/matrixssl.c
 
 #
 #   nanossl.o
 #
-DEPS_77 += $(CONFIG)/inc/bit.h
-DEPS_77 += $(CONFIG)/inc/mpr.h
+DEPS_79 += $(CONFIG)/inc/bit.h
+DEPS_79 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/nanossl.o: \
-    src/ssl/nanossl.c $(DEPS_77)
+    src/ssl/nanossl.c $(DEPS_79)
 	@echo '   [Compile] $(CONFIG)/obj/nanossl.o'
 	$(CC) -c -o $(CONFIG)/obj/nanossl.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" "-I$(BIT_PACK_MATRIXSSL_PATH)" "-I$(BIT_PACK_MATRIXSSL_PATH)/matrixssl" "-I$(BIT_PACK_NANOSSL_PATH)/src" "-I$(BIT_PACK_OPENSSL_PATH)/include" src/ssl/nanossl.c
 
 #
 #   openssl.o
 #
-DEPS_78 += $(CONFIG)/inc/bit.h
-DEPS_78 += $(CONFIG)/inc/mpr.h
+DEPS_80 += $(CONFIG)/inc/bit.h
+DEPS_80 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/openssl.o: \
-    src/ssl/openssl.c $(DEPS_78)
+    src/ssl/openssl.c $(DEPS_80)
 	@echo '   [Compile] $(CONFIG)/obj/openssl.o'
 	$(CC) -c -o $(CONFIG)/obj/openssl.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" "-I$(BIT_PACK_MATRIXSSL_PATH)" "-I$(BIT_PACK_MATRIXSSL_PATH)/matrixssl" "-I$(BIT_PACK_NANOSSL_PATH)/src" "-I$(BIT_PACK_OPENSSL_PATH)/include" src/ssl/openssl.c
 
 #
 #   ssl.o
 #
-DEPS_79 += $(CONFIG)/inc/bit.h
-DEPS_79 += $(CONFIG)/inc/mpr.h
+DEPS_81 += $(CONFIG)/inc/bit.h
+DEPS_81 += $(CONFIG)/inc/mpr.h
 
 $(CONFIG)/obj/ssl.o: \
-    src/ssl/ssl.c $(DEPS_79)
+    src/ssl/ssl.c $(DEPS_81)
 	@echo '   [Compile] $(CONFIG)/obj/ssl.o'
 	$(CC) -c -o $(CONFIG)/obj/ssl.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" "-I$(BIT_PACK_MATRIXSSL_PATH)" "-I$(BIT_PACK_MATRIXSSL_PATH)/matrixssl" "-I$(BIT_PACK_NANOSSL_PATH)/src" "-I$(BIT_PACK_OPENSSL_PATH)/include" src/ssl/ssl.c
 
 #
 #   libmprssl
 #
-DEPS_80 += $(CONFIG)/inc/bit.h
-DEPS_80 += $(CONFIG)/inc/bitos.h
-DEPS_80 += $(CONFIG)/inc/mpr.h
-DEPS_80 += $(CONFIG)/obj/async.o
-DEPS_80 += $(CONFIG)/obj/atomic.o
-DEPS_80 += $(CONFIG)/obj/buf.o
-DEPS_80 += $(CONFIG)/obj/cache.o
-DEPS_80 += $(CONFIG)/obj/cmd.o
-DEPS_80 += $(CONFIG)/obj/cond.o
-DEPS_80 += $(CONFIG)/obj/crypt.o
-DEPS_80 += $(CONFIG)/obj/disk.o
-DEPS_80 += $(CONFIG)/obj/dispatcher.o
-DEPS_80 += $(CONFIG)/obj/encode.o
-DEPS_80 += $(CONFIG)/obj/epoll.o
-DEPS_80 += $(CONFIG)/obj/event.o
-DEPS_80 += $(CONFIG)/obj/file.o
-DEPS_80 += $(CONFIG)/obj/fs.o
-DEPS_80 += $(CONFIG)/obj/hash.o
-DEPS_80 += $(CONFIG)/obj/json.o
-DEPS_80 += $(CONFIG)/obj/kqueue.o
-DEPS_80 += $(CONFIG)/obj/list.o
-DEPS_80 += $(CONFIG)/obj/lock.o
-DEPS_80 += $(CONFIG)/obj/log.o
-DEPS_80 += $(CONFIG)/obj/mem.o
-DEPS_80 += $(CONFIG)/obj/mime.o
-DEPS_80 += $(CONFIG)/obj/mixed.o
-DEPS_80 += $(CONFIG)/obj/module.o
-DEPS_80 += $(CONFIG)/obj/mpr.o
-DEPS_80 += $(CONFIG)/obj/path.o
-DEPS_80 += $(CONFIG)/obj/posix.o
-DEPS_80 += $(CONFIG)/obj/printf.o
-DEPS_80 += $(CONFIG)/obj/rom.o
-DEPS_80 += $(CONFIG)/obj/select.o
-DEPS_80 += $(CONFIG)/obj/signal.o
-DEPS_80 += $(CONFIG)/obj/socket.o
-DEPS_80 += $(CONFIG)/obj/string.o
-DEPS_80 += $(CONFIG)/obj/test.o
-DEPS_80 += $(CONFIG)/obj/thread.o
-DEPS_80 += $(CONFIG)/obj/time.o
-DEPS_80 += $(CONFIG)/obj/vxworks.o
-DEPS_80 += $(CONFIG)/obj/wait.o
-DEPS_80 += $(CONFIG)/obj/wide.o
-DEPS_80 += $(CONFIG)/obj/win.o
-DEPS_80 += $(CONFIG)/obj/wince.o
-DEPS_80 += $(CONFIG)/obj/xml.o
-DEPS_80 += $(CONFIG)/bin/libmpr.dylib
-DEPS_80 += $(CONFIG)/inc/est.h
-DEPS_80 += $(CONFIG)/obj/estLib.o
-ifeq ($(BIT_PACK_EST),1)
-    DEPS_80 += $(CONFIG)/bin/libest.dylib
-endif
-DEPS_80 += $(CONFIG)/obj/est.o
-DEPS_80 += $(CONFIG)/obj/matrixssl.o
-DEPS_80 += $(CONFIG)/obj/nanossl.o
-DEPS_80 += $(CONFIG)/obj/openssl.o
-DEPS_80 += $(CONFIG)/obj/ssl.o
-
-LIBS_80 += -lmpr
-ifeq ($(BIT_PACK_EST),1)
-    LIBS_80 += -lest
-endif
-ifeq ($(BIT_PACK_MATRIXSSL),1)
-    LIBS_80 += -lmatrixssl
-    LIBPATHS_80 += -L$(BIT_PACK_MATRIXSSL_PATH)
-endif
-ifeq ($(BIT_PACK_NANOSSL),1)
-    LIBS_80 += -lssls
-    LIBPATHS_80 += -L$(BIT_PACK_NANOSSL_PATH)/bin
-endif
-ifeq ($(BIT_PACK_OPENSSL),1)
-    LIBS_80 += -lssl
-    LIBPATHS_80 += -L$(BIT_PACK_OPENSSL_PATH)
-endif
-ifeq ($(BIT_PACK_OPENSSL),1)
-    LIBS_80 += -lcrypto
-    LIBPATHS_80 += -L$(BIT_PACK_OPENSSL_PATH)
-endif
-
-$(CONFIG)/bin/libmprssl.dylib: $(DEPS_80)
-	@echo '      [Link] $(CONFIG)/bin/libmprssl.dylib'
-	$(CC) -dynamiclib -o $(CONFIG)/bin/libmprssl.dylib -arch $(CC_ARCH) $(LDFLAGS) $(LIBPATHS)    -install_name @rpath/libmprssl.dylib -compatibility_version 4.4.0 -current_version 4.4.0 "$(CONFIG)/obj/est.o" "$(CONFIG)/obj/matrixssl.o" "$(CONFIG)/obj/nanossl.o" "$(CONFIG)/obj/openssl.o" "$(CONFIG)/obj/ssl.o" $(LIBPATHS_80) $(LIBS_80) $(LIBS_80) $(LIBS) 
-
-#
-#   manager.o
-#
-DEPS_81 += $(CONFIG)/inc/bit.h
-DEPS_81 += $(CONFIG)/inc/mpr.h
-
-$(CONFIG)/obj/manager.o: \
-    src/manager.c $(DEPS_81)
-	@echo '   [Compile] $(CONFIG)/obj/manager.o'
-	$(CC) -c -o $(CONFIG)/obj/manager.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/manager.c
-
-#
-#   manager
-#
 DEPS_82 += $(CONFIG)/inc/bit.h
 DEPS_82 += $(CONFIG)/inc/bitos.h
 DEPS_82 += $(CONFIG)/inc/mpr.h
@@ -1341,6 +1275,7 @@ DEPS_82 += $(CONFIG)/obj/dispatcher.o
 DEPS_82 += $(CONFIG)/obj/encode.o
 DEPS_82 += $(CONFIG)/obj/epoll.o
 DEPS_82 += $(CONFIG)/obj/event.o
+DEPS_82 += $(CONFIG)/obj/fiber.o
 DEPS_82 += $(CONFIG)/obj/file.o
 DEPS_82 += $(CONFIG)/obj/fs.o
 DEPS_82 += $(CONFIG)/obj/hash.o
@@ -1365,6 +1300,7 @@ DEPS_82 += $(CONFIG)/obj/string.o
 DEPS_82 += $(CONFIG)/obj/test.o
 DEPS_82 += $(CONFIG)/obj/thread.o
 DEPS_82 += $(CONFIG)/obj/time.o
+DEPS_82 += $(CONFIG)/obj/uring.o
 DEPS_82 += $(CONFIG)/obj/vxworks.o
 DEPS_82 += $(CONFIG)/obj/wait.o
 DEPS_82 += $(CONFIG)/obj/wide.o
@@ -1372,27 +1308,55 @@ DEPS_82 += $(CONFIG)/obj/win.o
 DEPS_82 += $(CONFIG)/obj/wince.o
 DEPS_82 += $(CONFIG)/obj/xml.o
 DEPS_82 += $(CONFIG)/bin/libmpr.dylib
-DEPS_82 += $(CONFIG)/obj/manager.o
+DEPS_82 += $(CONFIG)/inc/est.h
+DEPS_82 += $(CONFIG)/obj/estLib.o
+ifeq ($(BIT_PACK_EST),1)
+    DEPS_82 += $(CONFIG)/bin/libest.dylib
+endif
+DEPS_82 += $(CONFIG)/obj/est.o
+DEPS_82 += $(CONFIG)/obj/matrixssl.o
+DEPS_82 += $(CONFIG)/obj/nanossl.o
+DEPS_82 += $(CONFIG)/obj/openssl.o
+DEPS_82 += $(CONFIG)/obj/ssl.o
 
-LIBS_82 += -lmpr
+LIBS_80 += -lmpr
+ifeq ($(BIT_PACK_EST),1)
+    LIBS_80 += -lest
+endif
+ifeq ($(BIT_PACK_MATRIXSSL),1)
+    LIBS_80 += -lmatrixssl
+    LIBPATHS_80 += -L$(BIT_PACK_MATRIXSSL_PATH)
+endif
+ifeq ($(BIT_PACK_NANOSSL),1)
+    LIBS_80 += -lssls
+    LIBPATHS_80 += -L$(BIT_PACK_NANOSSL_PATH)/bin
+endif
+ifeq ($(BIT_PACK_OPENSSL),1)
+    LIBS_80 += -lssl
+    LIBPATHS_80 += -L$(BIT_PACK_OPENSSL_PATH)
+endif
+ifeq ($(BIT_PACK_OPENSSL),1)
+    LIBS_80 += -lcrypto
+    LIBPATHS_80 += -L$(BIT_PACK_OPENSSL_PATH)
+endif
 
-$(CONFIG)/bin/manager: $(DEPS_82)
-	@echo '      [Link] $(CONFIG)/bin/manager'
-	$(CC) -o $(CONFIG)/bin/manager -arch $(CC_ARCH) $(LDFLAGS) $(LIBPATHS) "$(CONFIG)/obj/manager.o" $(LIBPATHS_82) $(LIBS_82) $(LIBS_82) $(LIBS) 
+$(CONFIG)/bin/libmprssl.dylib: $(DEPS_82)
+	@echo '      [Link] $(CONFIG)/bin/libmprssl.dylib'
+	$(CC) -dynamiclib -o $(CONFIG)/bin/libmprssl.dylib -arch $(CC_ARCH) $(LDFLAGS) $(LIBPATHS)    -install_name @rpath/libmprssl.dylib -compatibility_version 4.4.0 -current_version 4.4.0 "$(CONFIG)/obj/est.o" "$(CONFIG)/obj/matrixssl.o" "$(CONFIG)/obj/nanossl.o" "$(CONFIG)/obj/openssl.o" "$(CONFIG)/obj/ssl.o" $(LIBPATHS_80) $(LIBS_80) $(LIBS_80) $(LIBS) 
 
 #
-#   makerom.o
+#   manager.o
 #
 DEPS_83 += $(CONFIG)/inc/bit.h
 DEPS_83 += $(CONFIG)/inc/mpr.h
 
-$(CONFIG)/obj/makerom.o: \
-    src/utils/makerom.c $(DEPS_83)
-	@echo '   [Compile] $(CONFIG)/obj/makerom.o'
-	$(CC) -c -o $(CONFIG)/obj/makerom.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/utils/makerom.c
+$(CONFIG)/obj/manager.o: \
+    src/manager.c $(DEPS_83)
+	@echo '   [Compile] $(CONFIG)/obj/manager.o'
+	$(CC) -c -o $(CONFIG)/obj/manager.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/manager.c
 
 #
-#   makerom
+#   manager
 #
 DEPS_84 += $(CONFIG)/inc/bit.h
 DEPS_84 += $(CONFIG)/inc/bitos.h
@@ -1409,6 +1373,7 @@ DEPS_84 += $(CONFIG)/obj/dispatcher.o
 DEPS_84 += $(CONFIG)/obj/encode.o
 DEPS_84 += $(CONFIG)/obj/epoll.o
 DEPS_84 += $(CONFIG)/obj/event.o
+DEPS_84 += $(CONFIG)/obj/fiber.o
 DEPS_84 += $(CONFIG)/obj/file.o
 DEPS_84 += $(CONFIG)/obj/fs.o
 DEPS_84 += $(CONFIG)/obj/hash.o
@@ -1433,6 +1398,7 @@ DEPS_84 += $(CONFIG)/obj/string.o
 DEPS_84 += $(CONFIG)/obj/test.o
 DEPS_84 += $(CONFIG)/obj/thread.o
 DEPS_84 += $(CONFIG)/obj/time.o
+DEPS_84 += $(CONFIG)/obj/uring.o
 DEPS_84 += $(CONFIG)/obj/vxworks.o
 DEPS_84 += $(CONFIG)/obj/wait.o
 DEPS_84 += $(CONFIG)/obj/wide.o
@@ -1440,27 +1406,27 @@ DEPS_84 += $(CONFIG)/obj/win.o
 DEPS_84 += $(CONFIG)/obj/wince.o
 DEPS_84 += $(CONFIG)/obj/xml.o
 DEPS_84 += $(CONFIG)/bin/libmpr.dylib
-DEPS_84 += $(CONFIG)/obj/makerom.o
+DEPS_84 += $(CONFIG)/obj/manager.o
 
-LIBS_84 += -lmpr
+LIBS_82 += -lmpr
 
-$(CONFIG)/bin/makerom: $(DEPS_84)
-	@echo '      [Link] $(CONFIG)/bin/makerom'
-	$(CC) -o $(CONFIG)/bin/makerom -arch $(CC_ARCH) $(LDFLAGS) $(LIBPATHS) "$(CONFIG)/obj/makerom.o" $(LIBPATHS_84) $(LIBS_84) $(LIBS_84) $(LIBS) 
+$(CONFIG)/bin/manager: $(DEPS_84)
+	@echo '      [Link] $(CONFIG)/bin/manager'
+	$(CC) -o $(CONFIG)/bin/manager -arch $(CC_ARCH) $(LDFLAGS) $(LIBPATHS) "$(CONFIG)/obj/manager.o" $(LIBPATHS_82) $(LIBS_82) $(LIBS_82) $(LIBS) 
 
 #
-#   charGen.o
+#   makerom.o
 #
 DEPS_85 += $(CONFIG)/inc/bit.h
 DEPS_85 += $(CONFIG)/inc/mpr.h
 
-$(CONFIG)/obj/charGen.o: \
-    src/utils/charGen.c $(DEPS_85)
-	@echo '   [Compile] $(CONFIG)/obj/charGen.o'
-	$(CC) -c -o $(CONFIG)/obj/charGen.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/utils/charGen.c
+$(CONFIG)/obj/makerom.o: \
+    src/utils/makerom.c $(DEPS_85)
+	@echo '   [Compile] $(CONFIG)/obj/makerom.o'
+	$(CC) -c -o $(CONFIG)/obj/makerom.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/utils/makerom.c
 
 #
-#   chargen
+#   makerom
 #
 DEPS_86 += $(CONFIG)/inc/bit.h
 DEPS_86 += $(CONFIG)/inc/bitos.h
@@ -1477,6 +1443,7 @@ DEPS_86 += $(CONFIG)/obj/dispatcher.o
 DEPS_86 += $(CONFIG)/obj/encode.o
 DEPS_86 += $(CONFIG)/obj/epoll.o
 DEPS_86 += $(CONFIG)/obj/event.o
+DEPS_86 += $(CONFIG)/obj/fiber.o
 DEPS_86 += $(CONFIG)/obj/file.o
 DEPS_86 += $(CONFIG)/obj/fs.o
 DEPS_86 += $(CONFIG)/obj/hash.o
@@ -1501,6 +1468,7 @@ DEPS_86 += $(CONFIG)/obj/string.o
 DEPS_86 += $(CONFIG)/obj/test.o
 DEPS_86 += $(CONFIG)/obj/thread.o
 DEPS_86 += $(CONFIG)/obj/time.o
+DEPS_86 += $(CONFIG)/obj/uring.o
 DEPS_86 += $(CONFIG)/obj/vxworks.o
 DEPS_86 += $(CONFIG)/obj/wait.o
 DEPS_86 += $(CONFIG)/obj/wide.o
@@ -1508,43 +1476,113 @@ DEPS_86 += $(CONFIG)/obj/win.o
 DEPS_86 += $(CONFIG)/obj/wince.o
 DEPS_86 += $(CONFIG)/obj/xml.o
 DEPS_86 += $(CONFIG)/bin/libmpr.dylib
-DEPS_86 += $(CONFIG)/obj/charGen.o
+DEPS_86 += $(CONFIG)/obj/makerom.o
+
+LIBS_84 += -lmpr
+
+$(CONFIG)/bin/makerom: $(DEPS_86)
+	@echo '      [Link] $(CONFIG)/bin/makerom'
+	$(CC) -o $(CONFIG)/bin/makerom -arch $(CC_ARCH) $(LDFLAGS) $(LIBPATHS) "$(CONFIG)/obj/makerom.o" $(LIBPATHS_84) $(LIBS_84) $(LIBS_84) $(LIBS) 
+
+#
+#   charGen.o
+#
+DEPS_87 += $(CONFIG)/inc/bit.h
+DEPS_87 += $(CONFIG)/inc/mpr.h
+
+$(CONFIG)/obj/charGen.o: \
+    src/utils/charGen.c $(DEPS_87)
+	@echo '   [Compile] $(CONFIG)/obj/charGen.o'
+	$(CC) -c -o $(CONFIG)/obj/charGen.o -arch $(CC_ARCH) $(CFLAGS) $(DFLAGS) "$(IFLAGS)" src/utils/charGen.c
+
+#
+#   chargen
+#
+DEPS_88 += $(CONFIG)/inc/bit.h
+DEPS_88 += $(CONFIG)/inc/bitos.h
+DEPS_88 += $(CONFIG)/inc/mpr.h
+DEPS_88 += $(CONFIG)/obj/async.o
+DEPS_88 += $(CONFIG)/obj/atomic.o
+DEPS_88 += $(CONFIG)/obj/buf.o
+DEPS_88 += $(CONFIG)/obj/cache.o
+DEPS_88 += $(CONFIG)/obj/cmd.o
+DEPS_88 += $(CONFIG)/obj/cond.o
+DEPS_88 += $(CONFIG)/obj/crypt.o
+DEPS_88 += $(CONFIG)/obj/disk.o
+DEPS_88 += $(CONFIG)/obj/dispatcher.o
+DEPS_88 += $(CONFIG)/obj/encode.o
+DEPS_88 += $(CONFIG)/obj/epoll.o
+DEPS_88 += $(CONFIG)/obj/event.o
+DEPS_88 += $(CONFIG)/obj/fiber.o
+DEPS_88 += $(CONFIG)/obj/file.o
+DEPS_88 += $(CONFIG)/obj/fs.o
+DEPS_88 += $(CONFIG)/obj/hash.o
+DEPS_88 += $(CONFIG)/obj/json.o
+DEPS_88 += $(CONFIG)/obj/kqueue.o
+DEPS_88 += $(CONFIG)/obj/list.o
+DEPS_88 += $(CONFIG)/obj/lock.o
+DEPS_88 += $(CONFIG)/obj/log.o
+DEPS_88 += $(CONFIG)/obj/mem.o
+DEPS_88 += $(CONFIG)/obj/mime.o
+DEPS_88 += $(CONFIG)/obj/mixed.o
+DEPS_88 += $(CONFIG)/obj/module.o
+DEPS_88 += $(CONFIG)/obj/mpr.o
+DEPS_88 += $(CONFIG)/obj/path.o
+DEPS_88 += $(CONFIG)/obj/posix.o
+DEPS_88 += $(CONFIG)/obj/printf.o
+DEPS_88 += $(CONFIG)/obj/rom.o
+DEPS_88 += $(CONFIG)/obj/select.o
+DEPS_88 += $(CONFIG)/obj/signal.o
+DEPS_88 += $(CONFIG)/obj/socket.o
+DEPS_88 += $(CONFIG)/obj/string.o
+DEPS_88 += $(CONFIG)/obj/test.o
+DEPS_88 += $(CONFIG)/obj/thread.o
+DEPS_88 += $(CONFIG)/obj/time.o
+DEPS_88 += $(CONFIG)/obj/uring.o
+DEPS_88 += $(CONFIG)/obj/vxworks.o
+DEPS_88 += $(CONFIG)/obj/wait.o
+DEPS_88 += $(CONFIG)/obj/wide.o
+DEPS_88 += $(CONFIG)/obj/win.o
+DEPS_88 += $(CONFIG)/obj/wince.o
+DEPS_88 += $(CONFIG)/obj/xml.o
+DEPS_88 += $(CONFIG)/bin/libmpr.dylib
+DEPS_88 += $(CONFIG)/obj/charGen.o
 
 LIBS_86 += -lmpr
 
-$(CONFIG)/bin/chargen: $(DEPS_86)
+$(CONFIG)/bin/chargen: $(DEPS_88)
 	@echo '      [Link] $(CONFIG)/bin/chargen'
 	$(CC) -o $(CONFIG)/bin/chargen -arch $(CC_ARCH) $(LDFLAGS) $(LIBPATHS) "$(CONFIG)/obj/charGen.o" $(LIBPATHS_86) $(LIBS_86) $(LIBS_86) $(LIBS) 
 
 #
 #   stop
 #
-stop: $(DEPS_87)
+stop: $(DEPS_89)
 
 #
 #   installBinary
 #
-installBinary: $(DEPS_88)
+installBinary: $(DEPS_90)
 
 #
 #   start
 #
-start: $(DEPS_89)
+start: $(DEPS_91)
 
 #
 #   install
 #
-DEPS_90 += stop
-DEPS_90 += installBinary
-DEPS_90 += start
+DEPS_92 += stop
+DEPS_92 += installBinary
+DEPS_92 += start
 
-install: $(DEPS_90)
+install: $(DEPS_92)
 	
 
 #
 #   uninstall
 #
-DEPS_91 += stop
+DEPS_93 += stop
 
-uninstall: $(DEPS_91)
+uninstall: $(DEPS_93)
 
@@ -58,12 +58,21 @@
 #ifndef BIT_HAS_UNNAMED_UNIONS
     #define BIT_HAS_UNNAMED_UNIONS 1
 #endif
+#ifndef BIT_MPR_FUTEX
+    #define BIT_MPR_FUTEX 1
+#endif
+#ifndef BIT_MPR_IO_URING
+    #define BIT_MPR_IO_URING 0
+#endif
 #ifndef BIT_MPR_LOGGING
     #define BIT_MPR_LOGGING 1
 #endif
 #ifndef BIT_MPR_MANAGER
     #define BIT_MPR_MANAGER "manager"
 #endif
+#ifndef BIT_MPR_SIGNALFD
+    #define BIT_MPR_SIGNALFD 0
+#endif
 #ifndef BIT_MPR_THREAD_STACK
     #define BIT_MPR_THREAD_STACK 0
 #endif
@@ -414,8 +414,16 @@
     #include    <sys/epoll.h>
     #include    <sys/prctl.h>
     #include    <sys/eventfd.h>
+    #include    <spawn.h>
+    #include    <sys/signalfd.h>
+    #include    <sys/syscall.h>
+    #include    <sys/timerfd.h>
+    #include    <linux/errqueue.h>
+    #include    <linux/filter.h>
+    #include    <linux/futex.h>
     #if !__UCLIBC__
         #include    <sys/sendfile.h>
+        #include    <ucontext.h>
     #endif
 #endif
 #if MACOSX
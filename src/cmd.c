@@ -12,6 +12,8 @@
 
 static int blendEnv(MprCmd *cmd, cchar **env, int flags);
 static void closeFiles(MprCmd *cmd);
+static void closePidfd(MprCmd *cmd);
+static void exitCallback(MprCmd *cmd, MprEvent *event);
 static void defaultCmdCallback(MprCmd *cmd, int channel, void *data);
 static int makeChannel(MprCmd *cmd, int index);
 static int makeCmdIO(MprCmd *cmd);
@@ -29,6 +31,14 @@ static void vxCmdManager(MprCmd *cmd);
 static cchar *makeWinEnvBlock(MprCmd *cmd);
 #endif
 
+#if LINUX && defined(__GLIBC__) && (__GLIBC__ > 2 || (__GLIBC__ == 2 && __GLIBC_MINOR__ >= 34))
+    /*
+        Use posix_spawn when there is no custom fork callback. Requires the chdir and closefrom file actions.
+     */
+    #define MPR_CMD_SPAWN 1
+static int spawnProcess(MprCmd *cmd);
+#endif
+
 #if VXWORKS
 typedef int (*MprCmdTaskFn)(int argc, char **argv, char **envp);
 static void cmdTaskEntry(char *program, MprCmdTaskFn entry, int cmdArg);
@@ -45,6 +55,43 @@ static void cmdTaskEntry(char *program, MprCmdTaskFn entry, int cmdArg);
     #define sunlock(cmd) 
 #endif
 
+/*
+    Command pool request and per-helper state. The helper state is stored in MprCmd.userData.
+ */
+typedef struct PoolRequest {
+    MprBuf          *data;              /* Framed request data yet to be written */
+    MprCmdPoolProc  proc;               /* Completion callback */
+    void            *arg;               /* Callback argument */
+} PoolRequest;
+
+typedef struct PoolHelper {
+    MprCmdPool      *pool;              /* Owning pool */
+    MprCmd          *cmd;               /* Helper command */
+    PoolRequest     *req;               /* Request in progress */
+    MprBuf          *response;          /* Response frame being received */
+    ssize           expect;             /* Length of response data. Set to -1 until the frame header is read */
+    int             served;             /* Count of requests serviced */
+} PoolHelper;
+
+typedef struct PoolResult {
+    char            *response;          /* Response data */
+    int             status;             /* Request status */
+    int             done;               /* Request complete */
+} PoolResult;
+
+static void finishPoolRequest(MprCmdPool *pool, PoolRequest *req, int status, cchar *response, ssize len);
+static void managePoolHelper(PoolHelper *hp, int flags);
+static void managePoolRequest(PoolRequest *req, int flags);
+static void managePoolResult(PoolResult *result, int flags);
+static void manageCmdPool(MprCmdPool *pool, int flags);
+static void poolCallback(MprCmd *cmd, int channel, PoolHelper *hp);
+static void readPoolResponse(MprCmd *cmd, PoolHelper *hp);
+static void restartPoolHelper(PoolHelper *hp, MprEvent *event);
+static void runPoolCallback(MprCmdPool *pool, int status, cchar *response, ssize len, PoolResult *result);
+static void servicePool(MprCmdPool *pool, MprEvent *event);
+static int startPoolHelper(MprCmdPool *pool, int index);
+static void writePoolRequest(MprCmd *cmd, PoolHelper *hp);
+
 /************************************* Code ***********************************/
 
 PUBLIC MprCmdService *mprCreateCmdService()
@@ -56,6 +103,29 @@ PUBLIC MprCmdService *mprCreateCmdService()
     }
     cs->cmds = mprCreateList(0, 0);
     cs->mutex = mprCreateLock();
+#if MPR_CMD_SPAWN
+    {
+        /*
+            The vfork child sets a 022 umask. Spawned children inherit the process umask, so only spawn if that matches.
+            The umask is per-process, so it is tested once here rather than changed around each spawn.
+         */
+        mode_t mode = umask(022);
+        umask(mode);
+        cs->spawn = (mode == 022);
+    }
+#endif
+#if LINUX && defined(__NR_pidfd_open)
+    {
+        /*
+            Process descriptors deliver exit notification for a specific child via the wait service
+         */
+        int fd;
+        if ((fd = (int) syscall(__NR_pidfd_open, getpid(), 0)) >= 0) {
+            cs->pidfd = 1;
+            close(fd);
+        }
+    }
+#endif
     return cs;
 }
 
@@ -95,6 +165,7 @@ PUBLIC MprCmd *mprCreateCmd(MprDispatcher *dispatcher)
     cmd->forkCallback = (MprForkCallback) closeFiles;
     cmd->dispatcher = dispatcher ? dispatcher : MPR->dispatcher;
     cmd->status = -1;
+    cmd->pidfd = -1;
 
 #if VXWORKS
     cmd->startCond = semCCreate(SEM_Q_PRIORITY, SEM_EMPTY);
@@ -130,6 +201,7 @@ static void manageCmd(MprCmd *cmd, int flags)
         mprMark(cmd->dispatcher);
         mprMark(cmd->callbackData);
         mprMark(cmd->signal);
+        mprMark(cmd->exitHandler);
         mprMark(cmd->forkData);
         mprMark(cmd->stdoutBuf);
         mprMark(cmd->stderrBuf);
@@ -236,6 +308,20 @@ static void resetCmd(MprCmd *cmd)
         reapCmd(cmd, 0);
         cmd->pid = 0;
     }
+    closePidfd(cmd);
+}
+
+
+static void closePidfd(MprCmd *cmd)
+{
+    if (cmd->exitHandler) {
+        mprRemoveWaitHandler(cmd->exitHandler);
+        cmd->exitHandler = 0;
+    }
+    if (cmd->pidfd >= 0) {
+        close(cmd->pidfd);
+        cmd->pidfd = -1;
+    }
 }
 
 
@@ -759,6 +845,10 @@ PUBLIC int mprWaitForCmd(MprCmd *cmd, MprTicks timeout)
         timeout = 0;
     }
     expires = mprGetTicks() + timeout;
+    if (cmd->dispatcher && cmd->dispatcher->deadline) {
+        expires = min(expires, cmd->dispatcher->deadline->expires);
+        timeout = max(expires - mprGetTicks(), 0);
+    }
     remaining = timeout;
 
     /* Add root to allow callers to use mprRunCmd without first managing the cmd */
@@ -791,10 +881,22 @@ PUBLIC int mprWaitForCmd(MprCmd *cmd, MprTicks timeout)
 }
 
 
+/*
+    The process descriptor is readable when the child has exited
+ */
+static void exitCallback(MprCmd *cmd, MprEvent *event)
+{
+    reapCmd(cmd, 0);
+    if (cmd->pid && cmd->exitHandler) {
+        mprWaitOn(cmd->exitHandler, MPR_READABLE);
+    }
+}
+
+
 /*
     Gather the child's exit status. 
     WARNING: this may be called with a false-positive, ie. SIGCHLD will get invoked for all process deaths and not just
-    when this cmd has completed.
+    when this cmd has completed. This does not happen if using a process descriptor (pidfd).
  */
 static void reapCmd(MprCmd *cmd, MprSignal *sp)
 {
@@ -822,9 +924,11 @@ static void reapCmd(MprCmd *cmd, MprSignal *sp)
                 mprTrace(7, "waitpid FUNNY pid %d, errno %d", cmd->pid, errno);
             }
             cmd->pid = 0;
-            assert(cmd->signal);
-            mprRemoveSignalHandler(cmd->signal);
-            cmd->signal = 0;
+            if (cmd->signal) {
+                mprRemoveSignalHandler(cmd->signal);
+                cmd->signal = 0;
+            }
+            closePidfd(cmd);
         } else {
             mprTrace(7, "waitpid ELSE pid %d, errno %d", cmd->pid, errno);
         }
@@ -1020,6 +1124,457 @@ PUBLIC void mprSetCmdDir(MprCmd *cmd, cchar *dir)
 }
 
 
+/*
+    Create a pool of helper commands. Each helper reads framed requests on stdin and writes framed responses to stdout.
+    A frame is a decimal length, a newline and then the data.
+ */
+PUBLIC MprCmdPool *mprCreateCmdPool(cchar *command, int count, int maxQueue, MprDispatcher *dispatcher)
+{
+    MprCmdPool  *pool;
+    int         i;
+
+    assert(command && *command);
+    assert(count > 0);
+
+    if ((pool = mprAllocObj(MprCmdPool, manageCmdPool)) == 0) {
+        return 0;
+    }
+    if ((pool->argc = mprMakeArgv(command, &pool->argv, 0)) <= 0 || pool->argv == 0) {
+        return 0;
+    }
+    pool->max = count;
+    pool->maxQueue = maxQueue;
+    pool->dispatcher = dispatcher ? dispatcher : MPR->dispatcher;
+    pool->helpers = mprCreateList(count, 0);
+    pool->queue = mprCreateList(0, 0);
+    pool->mutex = mprCreateLock();
+
+    for (i = 0; i < count; i++) {
+        if (startPoolHelper(pool, i) < 0) {
+            mprDestroyCmdPool(pool);
+            return 0;
+        }
+    }
+    return pool;
+}
+
+
+static void manageCmdPool(MprCmdPool *pool, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(pool->argv);
+        mprMark(pool->helpers);
+        mprMark(pool->queue);
+        mprMark(pool->dispatcher);
+        mprMark(pool->mutex);
+    }
+}
+
+
+static void managePoolHelper(PoolHelper *hp, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(hp->pool);
+        mprMark(hp->cmd);
+        mprMark(hp->req);
+        mprMark(hp->response);
+    }
+}
+
+
+static void managePoolRequest(PoolRequest *req, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(req->data);
+        mprMark(req->arg);
+    }
+}
+
+
+static void managePoolResult(PoolResult *result, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(result->response);
+    }
+}
+
+
+/*
+    Stop the helpers and abort all outstanding requests. Helpers are asked to exit by closing their stdin.
+ */
+PUBLIC void mprDestroyCmdPool(MprCmdPool *pool)
+{
+    MprCmd      *cmd;
+    PoolHelper  *hp;
+    PoolRequest *req;
+    int         next;
+
+    assert(pool);
+
+    lock(pool);
+    if (pool->destroyed) {
+        unlock(pool);
+        return;
+    }
+    pool->destroyed = 1;
+    unlock(pool);
+
+    for (ITERATE_ITEMS(pool->helpers, cmd, next)) {
+        hp = cmd->userData;
+        if ((req = hp->req) != 0) {
+            hp->req = 0;
+            finishPoolRequest(pool, req, MPR_ERR_ABORTED, NULL, 0);
+        }
+        if (cmd->files[MPR_CMD_STDIN].fd >= 0) {
+            mprFinalizeCmd(cmd);
+        }
+        if (mprIsCmdRunning(cmd) && mprWaitForCmd(cmd, MPR_TIMEOUT_STOP_TASK) < 0) {
+            mprStopCmd(cmd, -1);
+        }
+        mprDestroyCmd(cmd);
+    }
+    mprClearList(pool->helpers);
+
+    lock(pool);
+    while ((req = mprGetFirstItem(pool->queue)) != 0) {
+        mprRemoveItemAtPos(pool->queue, 0);
+        unlock(pool);
+        finishPoolRequest(pool, req, MPR_ERR_ABORTED, NULL, 0);
+        lock(pool);
+    }
+    unlock(pool);
+}
+
+
+/*
+    Queue a request for the next available helper. Returns MPR_ERR_BUSY if the queue is full so the caller can apply
+    back-pressure. This may be called from any thread; helper I/O is only done on the pool dispatcher.
+ */
+PUBLIC int mprSubmitCmdPool(MprCmdPool *pool, cchar *data, ssize len, MprCmdPoolProc proc, void *arg)
+{
+    PoolRequest     *req;
+
+    assert(pool);
+    assert(data);
+
+    if (len < 0) {
+        len = slen(data);
+    }
+    if ((req = mprAllocObj(PoolRequest, managePoolRequest)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    if ((req->data = mprCreateBuf(len + 16, -1)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    mprPutToBuf(req->data, "%d\n", (int) len);
+    mprPutBlockToBuf(req->data, data, len);
+    req->proc = proc;
+    req->arg = arg;
+
+    lock(pool);
+    if (pool->destroyed) {
+        unlock(pool);
+        return MPR_ERR_BAD_STATE;
+    }
+    if (pool->maxQueue > 0 && mprGetListLength(pool->queue) >= pool->maxQueue) {
+        unlock(pool);
+        return MPR_ERR_BUSY;
+    }
+    mprAddItem(pool->queue, req);
+    unlock(pool);
+
+    mprCreateEvent(pool->dispatcher, "cmdPool", 0, servicePool, pool, 0);
+    return 0;
+}
+
+
+/*
+    Run a request and wait for the response
+ */
+PUBLIC int mprRunCmdPool(MprCmdPool *pool, cchar *data, ssize len, char **response, MprTicks timeout)
+{
+    MprThreadService    *ts;
+    PoolResult          *result;
+    MprTicks            expires, remaining;
+    int                 rc;
+
+    assert(pool);
+    ts = MPR->threadService;
+
+    if (response) {
+        *response = 0;
+    }
+    if (timeout < 0) {
+        timeout = MAXINT;
+    }
+    if ((result = mprAllocObj(PoolResult, managePoolResult)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    if ((rc = mprSubmitCmdPool(pool, data, len, (MprCmdPoolProc) runPoolCallback, result)) < 0) {
+        return rc;
+    }
+    expires = mprGetTicks() + timeout;
+    remaining = timeout;
+
+    mprAddRoot(result);
+    while (!result->done && remaining > 0) {
+        if (mprShouldAbortRequests()) {
+            break;
+        }
+        if (!ts->eventsThread && mprGetCurrentThread() == ts->mainThread) {
+            mprServiceEvents(10, MPR_SERVICE_ONE_THING);
+            mprWaitForEvent(pool->dispatcher, 10);
+        } else {
+            mprWaitForEvent(pool->dispatcher, remaining);
+        }
+        remaining = (expires - mprGetTicks());
+    }
+    mprRemoveRoot(result);
+    if (!result->done) {
+        return MPR_ERR_TIMEOUT;
+    }
+    if (response) {
+        *response = result->response;
+    }
+    return result->status;
+}
+
+
+static void runPoolCallback(MprCmdPool *pool, int status, cchar *response, ssize len, PoolResult *result)
+{
+    result->status = status;
+    result->response = (char*) response;
+    result->done = 1;
+}
+
+
+static int startPoolHelper(MprCmdPool *pool, int index)
+{
+    MprCmd      *cmd;
+    PoolHelper  *hp;
+
+    if ((cmd = mprCreateCmd(pool->dispatcher)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    if ((hp = mprAllocObj(PoolHelper, managePoolHelper)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    hp->pool = pool;
+    hp->cmd = cmd;
+    hp->expect = -1;
+    hp->response = mprCreateBuf(BIT_MAX_BUFFER, -1);
+    cmd->userData = hp;
+    mprSetItem(pool->helpers, index, cmd);
+
+    mprSetCmdCallback(cmd, (MprCmdProc) poolCallback, hp);
+    if (mprStartCmd(cmd, pool->argc, pool->argv, NULL, MPR_CMD_IN | MPR_CMD_OUT) < 0) {
+        mprError("cmd: Cannot start pool helper %s", pool->argv[0]);
+        return MPR_ERR_CANT_CREATE;
+    }
+    /* Stdin events are enabled only while a request is being written */
+    mprDisableCmdEvents(cmd, MPR_CMD_STDIN);
+    return 0;
+}
+
+
+/*
+    Replace a helper that has exited. Helpers that exit before servicing any request are restarted after a delay
+    to avoid a tight restart loop for a failing helper program.
+ */
+static void restartPoolHelper(PoolHelper *hp, MprEvent *event)
+{
+    MprCmdPool  *pool;
+    int         index;
+
+    pool = hp->pool;
+    if (pool->destroyed || hp->cmd == 0 || (index = mprLookupItem(pool->helpers, hp->cmd)) < 0) {
+        /* Already restarted by a prior exit notification */
+        return;
+    }
+    mprDestroyCmd(hp->cmd);
+    hp->cmd = 0;
+    pool->restarts++;
+    mprLog(3, "cmd: Restart pool helper %s", pool->argv[0]);
+    if (startPoolHelper(pool, index) < 0) {
+        mprCreateEvent(pool->dispatcher, "restartHelper", MPR_TICKS_PER_SEC, restartPoolHelper, 
+            ((MprCmd*) mprGetItem(pool->helpers, index))->userData, 0);
+        return;
+    }
+    servicePool(pool, NULL);
+}
+
+
+/*
+    Assign queued requests to idle helpers. Runs on the pool dispatcher.
+ */
+static void servicePool(MprCmdPool *pool, MprEvent *event)
+{
+    MprCmd      *cmd;
+    PoolHelper  *hp;
+    PoolRequest *req;
+    int         next;
+
+    for (ITERATE_ITEMS(pool->helpers, cmd, next)) {
+        hp = cmd->userData;
+        if (hp->req || !mprIsCmdRunning(cmd)) {
+            continue;
+        }
+        lock(pool);
+        if ((req = mprGetFirstItem(pool->queue)) != 0) {
+            mprRemoveItemAtPos(pool->queue, 0);
+        }
+        unlock(pool);
+        if (req == 0) {
+            break;
+        }
+        hp->req = req;
+        writePoolRequest(cmd, hp);
+    }
+}
+
+
+static void poolCallback(MprCmd *cmd, int channel, PoolHelper *hp)
+{
+    MprCmdPool  *pool;
+    PoolRequest *req;
+
+    pool = hp->pool;
+    switch (channel) {
+    case MPR_CMD_STDIN:
+        writePoolRequest(cmd, hp);
+        break;
+
+    case MPR_CMD_STDOUT:
+        readPoolResponse(cmd, hp);
+        break;
+
+    default:
+        /* Helper exited. Fail the request in progress and restart the helper */
+        if ((req = hp->req) != 0) {
+            hp->req = 0;
+            finishPoolRequest(pool, req, MPR_ERR_CANT_COMPLETE, NULL, 0);
+        }
+        if (!pool->destroyed) {
+            mprCreateEvent(pool->dispatcher, "restartHelper", hp->served ? 0 : MPR_TICKS_PER_SEC, restartPoolHelper, 
+                hp, 0);
+        }
+        break;
+    }
+}
+
+
+/*
+    Write the request frame. The write is non-blocking and resumes on the next stdin writable event.
+ */
+static void writePoolRequest(MprCmd *cmd, PoolHelper *hp)
+{
+    PoolRequest *req;
+    ssize       len;
+    int         errCode;
+
+    if ((req = hp->req) == 0 || cmd->files[MPR_CMD_STDIN].fd < 0) {
+        return;
+    }
+    while (mprGetBufLength(req->data) > 0) {
+        len = mprWriteCmd(cmd, MPR_CMD_STDIN, mprGetBufStart(req->data), mprGetBufLength(req->data));
+        if (len < 0) {
+            errCode = mprGetError();
+            if (errCode == EAGAIN || errCode == EWOULDBLOCK) {
+                mprEnableCmdEvents(cmd, MPR_CMD_STDIN);
+            } else {
+                /* The request is failed when the helper is reaped */
+                mprStopCmd(cmd, -1);
+            }
+            return;
+        }
+        mprAdjustBufStart(req->data, len);
+    }
+}
+
+
+/*
+    Read the response frame and complete the request
+ */
+static void readPoolResponse(MprCmd *cmd, PoolHelper *hp)
+{
+    MprBuf      *buf;
+    PoolRequest *req;
+    char        *start, *nl, *response;
+    ssize       len, space;
+    int         errCode;
+
+    buf = hp->response;
+    space = mprGetBufSpace(buf);
+    if (space < (BIT_MAX_BUFFER / 4)) {
+        if (mprGrowBuf(buf, BIT_MAX_BUFFER) < 0) {
+            mprStopCmd(cmd, -1);
+            return;
+        }
+        space = mprGetBufSpace(buf);
+    }
+    len = mprReadCmd(cmd, MPR_CMD_STDOUT, mprGetBufEnd(buf), space);
+    errCode = mprGetError();
+    if (len <= 0) {
+        if (len == 0 || (len < 0 && !(errCode == EAGAIN || errCode == EWOULDBLOCK))) {
+            /* Helper closed its output. Stop it so it is reaped and restarted */
+            mprCloseCmdFd(cmd, MPR_CMD_STDOUT);
+            mprStopCmd(cmd, -1);
+            return;
+        }
+    } else {
+        mprAdjustBufEnd(buf, len);
+    }
+    /*
+        Consume complete frames. Bytes beyond the current frame are retained for the next request.
+     */
+    while (hp->req) {
+        if (hp->expect < 0) {
+            start = mprGetBufStart(buf);
+            if ((nl = memchr(start, '\n', mprGetBufLength(buf))) == 0) {
+                break;
+            }
+            *nl = '\0';
+            hp->expect = (ssize) stoi(start);
+            mprAdjustBufStart(buf, nl - start + 1);
+            if (hp->expect < 0) {
+                mprError("cmd: Bad response frame from pool helper %s", hp->pool->argv[0]);
+                mprStopCmd(cmd, -1);
+                return;
+            }
+        }
+        if (mprGetBufLength(buf) < hp->expect) {
+            break;
+        }
+        req = hp->req;
+        len = hp->expect;
+        if ((response = mprAlloc(len + 1)) == 0) {
+            mprStopCmd(cmd, -1);
+            return;
+        }
+        memcpy(response, mprGetBufStart(buf), len);
+        response[len] = '\0';
+        mprAdjustBufStart(buf, len);
+        mprCompactBuf(buf);
+        hp->expect = -1;
+        hp->req = 0;
+        hp->served++;
+        finishPoolRequest(hp->pool, req, 0, response, len);
+        servicePool(hp->pool, NULL);
+    }
+    if (cmd->files[MPR_CMD_STDOUT].fd >= 0) {
+        mprEnableCmdEvents(cmd, MPR_CMD_STDOUT);
+    }
+}
+
+
+static void finishPoolRequest(MprCmdPool *pool, PoolRequest *req, int status, cchar *response, ssize len)
+{
+    if (req->proc) {
+        (req->proc)(pool, status, response ? response : "", len, req->arg);
+    }
+}
+
+
 #if BIT_WIN_LIKE
 static int sortEnv(char **str1, char **str2)
 {
@@ -1474,12 +2029,17 @@ static int startProcess(MprCmd *cmd)
     int             rc, i, err;
 
     files = cmd->files;
-    if (!cmd->signal) {
+    if (!cmd->signal && !MPR->cmdService->pidfd) {
         cmd->signal = mprAddSignalHandler(SIGCHLD, reapCmd, cmd, cmd->dispatcher, MPR_SIGNAL_BEFORE);
     }
     /*
-        Create the child
+        Create the child. Use posix_spawn if there is no custom fork callback to run in the child.
      */
+#if MPR_CMD_SPAWN
+    if (cmd->forkCallback == (MprForkCallback) closeFiles && MPR->cmdService->spawn) {
+        cmd->pid = spawnProcess(cmd);
+    } else
+#endif
     cmd->pid = vfork();
 
     if (cmd->pid < 0) {
@@ -1491,6 +2051,10 @@ static int startProcess(MprCmd *cmd)
             Child
          */
         umask(022);
+#if MPR_SIGNALFD
+        /* Signals received via the signalfd are blocked and the mask is inherited over exec */
+        sigprocmask(SIG_UNBLOCK, &MPR->signalService->mask, 0);
+#endif
         if (cmd->flags & MPR_CMD_NEW_SESSION) {
             setsid();
         }
@@ -1548,11 +2112,102 @@ static int startProcess(MprCmd *cmd)
                 files[i].clientFd = -1;
             }
         }
+#if LINUX && defined(__NR_pidfd_open)
+        if (MPR->cmdService->pidfd) {
+            /*
+                Wait for exit on this child only. The descriptor is readable once the child is a zombie, so there is no 
+                race with an early exit.
+             */
+            if ((cmd->pidfd = (int) syscall(__NR_pidfd_open, cmd->pid, 0)) >= 0) {
+                fcntl(cmd->pidfd, F_SETFD, FD_CLOEXEC);
+                cmd->exitHandler = mprCreateWaitHandler(cmd->pidfd, MPR_READABLE, cmd->dispatcher, exitCallback, cmd, 0);
+            } 
+            if (cmd->exitHandler == 0) {
+                mprError("cmd: Cannot open process descriptor for %d, errno %d", cmd->pid, mprGetOsError());
+                closePidfd(cmd);
+                cmd->signal = mprAddSignalHandler(SIGCHLD, reapCmd, cmd, cmd->dispatcher, MPR_SIGNAL_BEFORE);
+                reapCmd(cmd, 0);
+            }
+        }
+#endif
     }
     return 0;
 }
 
 
+#if MPR_CMD_SPAWN
+/*
+    Create the child via posix_spawn. This runs no MPR code in the child and avoids copying the parent address space.
+    The file actions replicate the vfork child above and closeFiles(). The child inherits the process umask. There is
+    no spawn attribute for the umask, so this is only used if the umask matches the vfork child.
+    See mprCreateCmdService.
+    Returns the child pid or -1 with errno set.
+ */
+static int spawnProcess(MprCmd *cmd)
+{
+    MprCmdFile                  *files;
+    posix_spawn_file_actions_t  actions;
+    posix_spawnattr_t           attr;
+#if MPR_SIGNALFD
+    sigset_t                    mask;
+#endif
+    pid_t                       pid;
+    char                        **env;
+    short                       flags;
+    int                         fd, rc;
+#if MPR_SIGNALFD
+    int                         signo;
+#endif
+
+    files = cmd->files;
+    posix_spawn_file_actions_init(&actions);
+    posix_spawnattr_init(&attr);
+    flags = 0;
+
+    if (cmd->flags & MPR_CMD_NEW_SESSION) {
+        flags |= POSIX_SPAWN_SETSID;
+    }
+#if MPR_SIGNALFD
+    pthread_sigmask(SIG_SETMASK, 0, &mask);
+    for (signo = 1; signo < MPR_MAX_SIGNALS; signo++) {
+        if (sigismember(&MPR->signalService->mask, signo) == 1) {
+            sigdelset(&mask, signo);
+        }
+    }
+    posix_spawnattr_setsigmask(&attr, &mask);
+    flags |= POSIX_SPAWN_SETSIGMASK;
+#endif
+    posix_spawnattr_setflags(&attr, flags);
+
+    if (cmd->dir) {
+        posix_spawn_file_actions_addchdir_np(&actions, cmd->dir);
+    }
+    for (fd = 0; fd < MPR_CMD_MAX_PIPE; fd++) {
+        if (!(cmd->flags & (MPR_CMD_IN << fd))) {
+            continue;
+        }
+        if (files[fd].clientFd >= 0) {
+            posix_spawn_file_actions_adddup2(&actions, files[fd].clientFd, fd);
+        } else {
+            posix_spawn_file_actions_addclose(&actions, fd);
+        }
+    }
+    posix_spawn_file_actions_addclosefrom_np(&actions, 3);
+
+    env = cmd->env ? (char**) &cmd->env->items[0] : environ;
+    rc = posix_spawn(&pid, cmd->program, &actions, &attr, (char**) cmd->argv, env);
+
+    posix_spawn_file_actions_destroy(&actions);
+    posix_spawnattr_destroy(&attr);
+    if (rc != 0) {
+        errno = rc;
+        return -1;
+    }
+    return pid;
+}
+#endif
+
+
 #elif VXWORKS
 /*
     Start the command to run (stdIn and stdOut are named from the client's perspective)
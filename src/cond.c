@@ -9,6 +9,10 @@
 /***************************** Forward Declarations ***************************/
 
 static void manageCond(MprCond *cp, int flags);
+#if MPR_FUTEX
+static int futexWait(volatile int *addr, int value, MprTicks timeout);
+static void futexWake(volatile int *addr, int count);
+#endif
 
 /************************************ Code ************************************/
 /*
@@ -23,14 +27,20 @@ PUBLIC MprCond *mprCreateCond()
         return 0;
     }
     cp->triggered = 0;
-    cp->mutex = mprCreateLock();
 
+#if MPR_FUTEX
+    cp->mutex = 0;
+    cp->seq = 0;
+    cp->waiters = 0;
+#else
+    cp->mutex = mprCreateLock();
 #if BIT_WIN_LIKE
     cp->cv = CreateEvent(NULL, FALSE, FALSE, NULL);
 #elif VXWORKS
     cp->cv = semCCreate(SEM_Q_PRIORITY, SEM_EMPTY);
 #else
     pthread_cond_init(&cp->cv, NULL);
+#endif
 #endif
     return cp;
 }
@@ -44,8 +54,9 @@ static void manageCond(MprCond *cp, int flags)
         mprMark(cp->mutex);
 
     } else if (flags & MPR_MANAGE_FREE) {
-        assert(cp->mutex);
-#if BIT_WIN_LIKE
+#if MPR_FUTEX
+        assert(cp->waiters == 0);
+#elif BIT_WIN_LIKE
         CloseHandle(cp->cv);
 #elif VXWORKS
         semDelete(cp->cv);
@@ -56,6 +67,121 @@ static void manageCond(MprCond *cp, int flags)
 }
 
 
+#if MPR_FUTEX
+/*
+    Futex based condition variables. The triggered flag is the futex word for single waiters, so signalling and 
+    waiting on an already triggered condition do not take a lock or make a system call. Timeouts are relative and 
+    measured against the monotonic clock by the kernel.
+ */
+PUBLIC int mprWaitForCond(MprCond *cp, MprTicks timeout)
+{
+    MprTicks    expire, remaining;
+    int         rc;
+
+    if (__sync_bool_compare_and_swap(&cp->triggered, 1, 0)) {
+        return 0;
+    }
+    if (timeout == 0) {
+        return MPR_ERR_TIMEOUT;
+    }
+    expire = (timeout > 0) ? mprGetTicks() + timeout : 0;
+    remaining = timeout;
+    while (1) {
+        __sync_fetch_and_add(&cp->waiters, 1);
+        rc = futexWait(&cp->triggered, 0, remaining);
+        __sync_fetch_and_sub(&cp->waiters, 1);
+        if (__sync_bool_compare_and_swap(&cp->triggered, 1, 0)) {
+            return 0;
+        }
+        if (rc < 0) {
+            return rc;
+        }
+        if (timeout > 0 && (remaining = expire - mprGetTicks()) <= 0) {
+            return MPR_ERR_TIMEOUT;
+        }
+    }
+}
+
+
+/*
+    Signal a condition and wakeup the waiter. Note: this may be called prior to the waiter waiting.
+    A waiter registers before sleeping and the futex wait fails if the condition has been triggered, so the wakeup 
+    is only required if there are registered waiters.
+ */
+PUBLIC void mprSignalCond(MprCond *cp)
+{
+    if (!cp->triggered && __sync_bool_compare_and_swap(&cp->triggered, 0, 1) && cp->waiters > 0) {
+        futexWake(&cp->triggered, 1);
+    }
+}
+
+
+PUBLIC void mprResetCond(MprCond *cp)
+{
+    cp->triggered = 0;
+    mprAtomicBarrier();
+}
+
+
+/*
+    Wait for the event to be signalled when there may be multiple waiters. This routine may return early due to
+    other signals or events. The caller must verify if the signalled condition truly exists. 
+    Returns 0 if the event was signalled. Returns < 0 for a timeout.
+ */
+PUBLIC int mprWaitForMultiCond(MprCond *cp, MprTicks timeout)
+{
+    int     rc, seq;
+
+    seq = cp->seq;
+    __sync_fetch_and_add(&cp->waiters, 1);
+    rc = futexWait(&cp->seq, seq, timeout < 0 ? MAXINT : timeout);
+    __sync_fetch_and_sub(&cp->waiters, 1);
+    return rc;
+}
+
+
+/*
+    Signal a condition and wakeup the all the waiters. Waiters that have not yet slept see the changed sequence.
+ */
+PUBLIC void mprSignalMultiCond(MprCond *cp)
+{
+    __sync_fetch_and_add(&cp->seq, 1);
+    if (cp->waiters > 0) {
+        futexWake(&cp->seq, MAXINT);
+    }
+}
+
+
+/*
+    Sleep while *addr == value. Returns 0 if woken, the value changed or interrupted. Returns MPR_ERR_TIMEOUT on timeout.
+ */
+static int futexWait(volatile int *addr, int value, MprTicks timeout)
+{
+    struct timespec     ts, *tsp;
+
+    tsp = 0;
+    if (timeout >= 0) {
+        ts.tv_sec = (time_t) (timeout / 1000);
+        ts.tv_nsec = (long) (timeout % 1000) * 1000000;
+        tsp = &ts;
+    }
+    if (syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, value, tsp, NULL, 0) < 0) {
+        if (errno == ETIMEDOUT) {
+            return MPR_ERR_TIMEOUT;
+        }
+        assert(errno == EAGAIN || errno == EINTR);
+    }
+    return 0;
+}
+
+
+static void futexWake(volatile int *addr, int count)
+{
+    syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, count, NULL, NULL, 0);
+}
+
+#else /* !MPR_FUTEX */
+
 /*
     Wait for the event to be triggered. Should only be used when there are single waiters. If the event is already
     triggered, then it will return immediately. Timeout of -1 means wait forever. Timeout of 0 means no wait.
@@ -290,6 +416,7 @@ PUBLIC void mprSignalMultiCond(MprCond *cp)
 #endif
     mprUnlock(cp->mutex);
 }
+#endif /* MPR_FUTEX */
 
 
 /*
@@ -15,17 +15,26 @@
 static MprDispatcher *createQhead(cchar *name);
 static void dequeueDispatcher(MprDispatcher *dispatcher);
 static int dispatchEvents(MprDispatcher *dispatcher);
-static void dispatchEventsWorker(MprDispatcher *dispatcher);
+static void dispatchEventsWorker(MprDispatcher *dispatcher, MprWorker *worker);
+static void drainEvents(MprDispatcher *dispatcher, int count);
 static MprTicks getDispatcherIdleTicks(MprDispatcher *dispatcher, MprTicks timeout);
 static MprTicks getIdleTicks(MprEventService *es, MprTicks timeout);
+static bool canStartWorker(MprEventService *es, MprDispatcher *dispatcher);
+static bool hasReadyDispatchers(MprEventService *es);
 static MprDispatcher *getNextReadyDispatcher(MprEventService *es);
+static int histBucket(uint64 value);
 static void initDispatcher(MprDispatcher *q);
 static void manageDispatcher(MprDispatcher *dispatcher, int flags);
 static void manageEventService(MprEventService *es, int flags);
+static void printDispatcherStats(MprDispatcher *q);
+static void printStatsSignal(void *ignored, MprSignal *sp);
 static void queueDispatcher(MprDispatcher *prior, MprDispatcher *dispatcher);
+static void recordEvent(MprEventService *es, MprDispatcher *dispatcher, cchar *name, MprTicks delay, uint64 start);
+static void resetDispatcherStats(MprDispatcher *q);
+static MprDispatcher *selectReadyDispatcher(MprEventService *es);
 
 #define isRunning(dispatcher) (dispatcher->parent == dispatcher->service->runQ)
-#define isReady(dispatcher) (dispatcher->parent == dispatcher->service->readyQ)
+#define isReady(dispatcher) (dispatcher->parent == dispatcher->service->readyQ[dispatcher->priority])
 #define isWaiting(dispatcher) (dispatcher->parent == dispatcher->service->waitQ)
 #define isEmpty(dispatcher) (dispatcher->eventQ->next == dispatcher->eventQ)
 
@@ -36,6 +45,7 @@ static void queueDispatcher(MprDispatcher *prior, MprDispatcher *dispatcher);
 PUBLIC MprEventService *mprCreateEventService()
 {
     MprEventService     *es;
+    int                 pri;
 
     if ((es = mprAllocObj(MprEventService, manageEventService)) == 0) {
         return 0;
@@ -45,32 +55,43 @@ PUBLIC MprEventService *mprCreateEventService()
     es->mutex = mprCreateLock();
     es->waitCond = mprCreateCond();
     es->runQ = createQhead("running");
-    es->readyQ = createQhead("ready");
+    for (pri = 0; pri < MPR_DISPATCHER_CLASSES; pri++) {
+        es->readyQ[pri] = createQhead("ready");
+    }
+    es->weight[MPR_DISPATCHER_CLASS_HIGH] = 8;
+    es->weight[MPR_DISPATCHER_CLASS_NORMAL] = 4;
+    es->weight[MPR_DISPATCHER_CLASS_LOW] = 1;
     es->idleQ = createQhead("idle");
     es->pendingQ = createQhead("pending");
     es->waitQ = createQhead("waiting");
+    es->batchCount = MPR_DISPATCHER_BATCH;
     return es;
 }
 
 
 static void manageEventService(MprEventService *es, int flags)
 {
-    MprDispatcher   *dp;
+    MprDispatcher   *dp, *readyQ;
+    int             pri;
 
     if (flags & MPR_MANAGE_MARK) {
         mprMark(es->runQ);
-        mprMark(es->readyQ);
         mprMark(es->waitQ);
         mprMark(es->idleQ);
         mprMark(es->pendingQ);
         mprMark(es->waitCond);
         mprMark(es->mutex);
+        mprMark(es->statsSignal);
 
         for (dp = es->runQ->next; dp != es->runQ; dp = dp->next) {
             mprMark(dp);
         }
-        for (dp = es->readyQ->next; dp != es->readyQ; dp = dp->next) {
-            mprMark(dp);
+        for (pri = 0; pri < MPR_DISPATCHER_CLASSES; pri++) {
+            readyQ = es->readyQ[pri];
+            mprMark(readyQ);
+            for (dp = readyQ->next; dp != readyQ; dp = dp->next) {
+                mprMark(dp);
+            }
         }
         for (dp = es->waitQ->next; dp != es->waitQ; dp = dp->next) {
             mprMark(dp);
@@ -127,6 +148,13 @@ PUBLIC MprDispatcher *mprCreateDispatcher(cchar *name, int flags)
     }
     dispatcher->flags = flags;
     dispatcher->service = es;
+    if (flags & MPR_DISPATCHER_HIGH) {
+        dispatcher->priority = MPR_DISPATCHER_CLASS_HIGH;
+    } else if (flags & MPR_DISPATCHER_LOW) {
+        dispatcher->priority = MPR_DISPATCHER_CLASS_LOW;
+    } else {
+        dispatcher->priority = MPR_DISPATCHER_CLASS_NORMAL;
+    }
     dispatcher->name = sclone(name);
     dispatcher->cond = mprCreateCond();
     dispatcher->eventQ = mprCreateEventQueue();
@@ -174,6 +202,9 @@ static void manageDispatcher(MprDispatcher *dispatcher, int flags)
         mprMark(dispatcher->cond);
         mprMark(dispatcher->parent);
         mprMark(dispatcher->service);
+        mprMark(dispatcher->worker);
+        mprMark(dispatcher->stats);
+        mprMark(dispatcher->deadline);
 
         if ((q = dispatcher->eventQ) != 0) {
             for (event = q->next; event != q; event = next) {
@@ -208,6 +239,7 @@ PUBLIC int mprServiceEvents(MprTicks timeout, int flags)
     MprEventService     *es;
     MprDispatcher       *dp;
     MprTicks            expires, delay;
+    uint64              active, start, elapsed;
     int                 beginEventCount, eventCount, justOne;
 
     if (MPR->eventing) {
@@ -225,17 +257,33 @@ PUBLIC int mprServiceEvents(MprTicks timeout, int flags)
         expires = MAXINT64;
     }
     justOne = (flags & MPR_SERVICE_ONE_THING) ? 1 : 0;
+    active = es->spinBudget ? mprGetMicroTicks() : 0;
 
     while (es->now < expires) {
         eventCount = es->eventCount;
+        start = es->statsEnabled ? mprGetMicroTicks() : 0;
+#if MPR_SIGNALFD
+        /*
+            Asynchronous signals are read by the signalfd wait handler. Only signals outside the signalfd mask 
+            (thread directed signals such as SIGPIPE) are flagged by the signal handler for servicing here.
+         */
+        if (MPR->signalService->handler == 0 || MPR->signalService->hasSignals) {
+            mprServiceSignals();
+        }
+#else
         mprServiceSignals();
+#endif
 
         while ((dp = getNextReadyDispatcher(es)) != NULL) {
+            if (es->spinBudget) {
+                active = mprGetMicroTicks();
+            }
             queueDispatcher(es->runQ, dp);
             if (dp->flags & MPR_DISPATCHER_IMMEDIATE) {
-                dispatchEventsWorker(dp);
+                dispatchEventsWorker(dp, NULL);
 
-            } else if (mprStartWorker((MprWorkerProc) dispatchEventsWorker, dp) < 0) {
+            } else if (!canStartWorker(es, dp) || 
+                    mprStartPreferredWorker(dp->worker, (MprWorkerProc) dispatchEventsWorker, dp) < 0) {
                 queueDispatcher(es->pendingQ, dp);
                 continue;
             }
@@ -244,12 +292,35 @@ PUBLIC int mprServiceEvents(MprTicks timeout, int flags)
                 break;
             }
         } 
+        if (start && es->statsEnabled) {
+            elapsed = mprGetMicroTicks() - start;
+            es->loops++;
+            es->loopTime[histBucket(elapsed)]++;
+            es->maxLoopTime = max(es->maxLoopTime, elapsed);
+        }
         if (es->eventCount == eventCount) {
             lock(es);
             delay = getIdleTicks(es, expires - es->now);
-            if (delay > 0) {
+            if (delay > 0 && es->spinBudget > 0 && (mprGetMicroTicks() - active) < (uint64) es->spinBudget) {
+                /*
+                    Busy-poll for I/O. While spinning, schedulers do not need to wake the notifier.
+                 */
+                es->spinning = 1;
+                unlock(es);
+                mprWaitForIO(MPR->waitService, 0);
+                es->spinning = 0;
+
+            } else if (delay > 0) {
                 es->willAwake = es->now + delay;
                 es->waiting = 1;
+#if MPR_WAIT_TIMER
+                /*
+                    Arm the notifier timer while locked so mprScheduleDispatcher can safely advance it
+                 */
+                if (mprSetWaitTimer(MPR->waitService, delay) == 0) {
+                    delay = -1;
+                }
+#endif
                 unlock(es);
                 /*
                     Wait for something to happen
@@ -258,6 +329,8 @@ PUBLIC int mprServiceEvents(MprTicks timeout, int flags)
             } else {
                 unlock(es);
             }
+        } else if (es->spinBudget) {
+            active = mprGetMicroTicks();
         }
         es->now = mprGetTicks();
         if (justOne || mprIsStopping()) {
@@ -293,6 +366,9 @@ PUBLIC int mprWaitForEvent(MprDispatcher *dispatcher, MprTicks timeout)
     }
     thread = mprGetCurrentOsThread();
     expires = timeout < 0 ? (es->now + MPR_MAX_TIMEOUT) : (es->now + timeout);
+    if (dispatcher->deadline) {
+        expires = min(expires, dispatcher->deadline->expires);
+    }
     signalled = 0;
 
     lock(es);
@@ -310,6 +386,9 @@ PUBLIC int mprWaitForEvent(MprDispatcher *dispatcher, MprTicks timeout)
                 break;
             }
         }
+        if (mprIsDeadlineExpired(dispatcher->deadline)) {
+            break;
+        }
         lock(es);
         delay = getDispatcherIdleTicks(dispatcher, expires - es->now);
         dispatcher->flags |= MPR_DISPATCHER_WAITING;
@@ -325,11 +404,18 @@ PUBLIC int mprWaitForEvent(MprDispatcher *dispatcher, MprTicks timeout)
             if (runEvents) {
                 dispatchEvents(dispatcher);
             }
-            signalled++;
+            if (!mprIsDeadlineExpired(dispatcher->deadline)) {
+                signalled++;
+            }
             break;
         }
         es->now = mprGetTicks();
     }
+    if (dispatcher->deadline && !mprIsDeadlineExpired(dispatcher->deadline) && 
+            mprGetTicks() >= dispatcher->deadline->expires) {
+        /* The wait ended at the deadline before the deadline timer ran */
+        mprCancelDeadline(dispatcher->deadline);
+    }
     if (runEvents && !wasRunning) {
         dequeueDispatcher(dispatcher);
         mprScheduleDispatcher(dispatcher);
@@ -344,6 +430,256 @@ PUBLIC void mprClearWaiting()
 }
 
 
+PUBLIC int mprSetEventSpin(int usec)
+{
+    MprEventService     *es;
+    int                 old;
+
+    assert(usec >= 0);
+    es = MPR->eventService;
+    old = es->spinBudget;
+    es->spinBudget = usec;
+    return old;
+}
+
+
+PUBLIC int mprSetDispatcherClass(int priority, int weight, int reserve)
+{
+    MprEventService     *es;
+
+    if (priority < 0 || priority >= MPR_DISPATCHER_CLASSES || weight < 1 || reserve < 0) {
+        return MPR_ERR_BAD_ARGS;
+    }
+    es = MPR->eventService;
+    lock(es);
+    es->weight[priority] = weight;
+    es->credit[priority] = min(es->credit[priority], weight);
+    es->reserve[priority] = reserve;
+    unlock(es);
+    /* Pending dispatchers may now be able to start a worker */
+    mprWakeEventService();
+    return 0;
+}
+
+
+PUBLIC int mprSetDispatcherPriority(MprDispatcher *dispatcher, int priority)
+{
+    MprEventService     *es;
+    int                 wasReady;
+
+    if (dispatcher == 0 || priority < 0 || priority >= MPR_DISPATCHER_CLASSES) {
+        return MPR_ERR_BAD_ARGS;
+    }
+    es = dispatcher->service;
+    lock(es);
+    wasReady = isReady(dispatcher);
+    dispatcher->priority = priority;
+    if (wasReady) {
+        queueDispatcher(es->readyQ[priority], dispatcher);
+    }
+    unlock(es);
+    return 0;
+}
+
+
+PUBLIC void mprSetEventStats(bool enable, int signo)
+{
+    MprEventService     *es;
+    int                 pri;
+
+    es = MPR->eventService;
+    lock(es);
+    if (enable && !es->statsEnabled) {
+        es->loops = 0;
+        es->maxLoopTime = 0;
+        memset(es->loopTime, 0, sizeof(es->loopTime));
+        memset(es->slowest, 0, sizeof(es->slowest));
+        resetDispatcherStats(es->runQ);
+        for (pri = 0; pri < MPR_DISPATCHER_CLASSES; pri++) {
+            resetDispatcherStats(es->readyQ[pri]);
+        }
+        resetDispatcherStats(es->waitQ);
+        resetDispatcherStats(es->idleQ);
+        resetDispatcherStats(es->pendingQ);
+    }
+    es->statsEnabled = enable;
+    unlock(es);
+
+    if (es->statsSignal) {
+        mprRemoveSignalHandler(es->statsSignal);
+        es->statsSignal = 0;
+    }
+    if (enable && signo > 0) {
+        es->statsSignal = mprAddSignalHandler(signo, printStatsSignal, 0, 0, MPR_SIGNAL_AFTER);
+    }
+}
+
+
+PUBLIC MprEventStats *mprGetDispatcherStats(MprDispatcher *dispatcher)
+{
+    if (dispatcher == 0) {
+        dispatcher = MPR->dispatcher;
+    }
+    return dispatcher->stats;
+}
+
+
+PUBLIC uint64 mprGetEventStatsPercentile(uint64 *hist, int percent)
+{
+    uint64      total, sum, target;
+    int         i;
+
+    for (total = 0, i = 0; i < MPR_EVENT_HIST; i++) {
+        total += hist[i];
+    }
+    if (total == 0) {
+        return 0;
+    }
+    target = (total * percent + 99) / 100;
+    for (sum = 0, i = 0; i < MPR_EVENT_HIST - 1; i++) {
+        sum += hist[i];
+        if (sum >= target) {
+            break;
+        }
+    }
+    return i == 0 ? 0 : (((uint64) 1) << i) - 1;
+}
+
+
+PUBLIC void mprPrintEventStats()
+{
+    MprEventService     *es;
+    MprSlowEvent        *sp;
+    int                 i;
+
+    es = MPR->eventService;
+    if (!es->statsEnabled) {
+        return;
+    }
+    lock(es);
+    mprRawLog(0, "\nEvent Statistics\n");
+    mprRawLog(0, "----------------\n");
+    mprRawLog(0, "  Loop iterations   %14Ld\n", es->loops);
+    mprRawLog(0, "  Loop time usec    p50 %Ld, p99 %Ld, max %Ld\n", 
+        min(mprGetEventStatsPercentile(es->loopTime, 50), es->maxLoopTime), 
+        min(mprGetEventStatsPercentile(es->loopTime, 99), es->maxLoopTime), es->maxLoopTime);
+    mprRawLog(0, "\n  Slowest callbacks\n");
+    for (i = 0; i < MPR_EVENT_SLOWEST; i++) {
+        sp = &es->slowest[i];
+        if (sp->runtime == 0) {
+            break;
+        }
+        mprRawLog(0, "    %-32s %-24s %12Ld usec\n", sp->name, sp->dispatcher, sp->runtime);
+    }
+    mprRawLog(0, "\n  %-24s %10s %30s %30s\n", "Dispatcher", "Events", "Delay msec (p50/p99/max)", 
+        "Runtime usec (p50/p99/max)");
+    printDispatcherStats(es->runQ);
+    for (i = 0; i < MPR_DISPATCHER_CLASSES; i++) {
+        printDispatcherStats(es->readyQ[i]);
+    }
+    printDispatcherStats(es->waitQ);
+    printDispatcherStats(es->idleQ);
+    printDispatcherStats(es->pendingQ);
+    unlock(es);
+}
+
+
+static void printDispatcherStats(MprDispatcher *q)
+{
+    MprDispatcher   *dp;
+    MprEventStats   *st;
+
+    for (dp = q->next; dp != q; dp = dp->next) {
+        if ((st = dp->stats) == 0 || st->count == 0) {
+            continue;
+        }
+        /*
+            Percentiles are bucket upper bounds so limit to the observed maximum
+         */
+        mprRawLog(0, "  %-24s %10Ld %12Ld/%Ld/%Ld %18Ld/%Ld/%Ld\n", dp->name, st->count,
+            min(mprGetEventStatsPercentile(st->delay, 50), (uint64) st->maxDelay), 
+            min(mprGetEventStatsPercentile(st->delay, 99), (uint64) st->maxDelay), st->maxDelay,
+            min(mprGetEventStatsPercentile(st->runtime, 50), st->maxRuntime), 
+            min(mprGetEventStatsPercentile(st->runtime, 99), st->maxRuntime), st->maxRuntime);
+    }
+}
+
+
+static void resetDispatcherStats(MprDispatcher *q)
+{
+    MprDispatcher   *dp;
+
+    for (dp = q->next; dp != q; dp = dp->next) {
+        dp->stats = 0;
+    }
+}
+
+
+static void printStatsSignal(void *ignored, MprSignal *sp)
+{
+    mprPrintEventStats();
+}
+
+
+/*
+    Return the log2 histogram bucket for a value
+ */
+static int histBucket(uint64 value)
+{
+    int     bucket;
+
+    for (bucket = 0; value > 0 && bucket < MPR_EVENT_HIST - 1; bucket++) {
+        value >>= 1;
+    }
+    return bucket;
+}
+
+
+/*
+    Record the scheduling delay and runtime of an event callback. Must be called locked.
+ */
+static void recordEvent(MprEventService *es, MprDispatcher *dispatcher, cchar *name, MprTicks delay, uint64 start)
+{
+    MprEventStats   *st;
+    MprSlowEvent    *sp;
+    uint64          runtime;
+    int             i;
+
+    runtime = mprGetMicroTicks() - start;
+    if ((st = dispatcher->stats) == 0) {
+        return;
+    }
+    st->count++;
+    st->delay[histBucket(delay)]++;
+    st->runtime[histBucket(runtime)]++;
+    st->maxDelay = max(st->maxDelay, delay);
+    st->maxRuntime = max(st->maxRuntime, runtime);
+
+    if (runtime <= es->slowest[MPR_EVENT_SLOWEST - 1].runtime) {
+        return;
+    }
+    for (i = MPR_EVENT_SLOWEST - 1; i > 0 && es->slowest[i - 1].runtime < runtime; i--) {
+        es->slowest[i] = es->slowest[i - 1];
+    }
+    sp = &es->slowest[i];
+    scopy(sp->name, sizeof(sp->name), name ? name : "unknown");
+    scopy(sp->dispatcher, sizeof(sp->dispatcher), dispatcher->name ? dispatcher->name : "unknown");
+    sp->runtime = runtime;
+    sp->when = mprGetTicks();
+}
+
+
+PUBLIC void mprSetDispatcherBatch(int count, MprTicks timeout)
+{
+    MprEventService     *es;
+
+    assert(count >= 0 && timeout >= 0);
+    es = MPR->eventService;
+    es->batchCount = count;
+    es->batchTime = timeout;
+}
+
+
 PUBLIC void mprWakeEventService()
 {
     if (MPR->eventService->waiting) {
@@ -442,7 +778,7 @@ PUBLIC void mprScheduleDispatcher(MprDispatcher *dispatcher)
     lock(es);
     if (isRunning(dispatcher)) {
         mustWakeWaitService = es->waiting;
-        mustWakeCond = dispatcher->flags & MPR_DISPATCHER_WAITING;
+        mustWakeCond = dispatcher->flags & (MPR_DISPATCHER_WAITING | MPR_DISPATCHER_LINGER);
 
     } else {
         if (isEmpty(dispatcher)) {
@@ -457,13 +793,28 @@ PUBLIC void mprScheduleDispatcher(MprDispatcher *dispatcher)
             if (event->due < es->willAwake) {
                 mustWakeWaitService = 1;
                 mustWakeCond = dispatcher->flags & MPR_DISPATCHER_WAITING;
+#if MPR_WAIT_TIMER
+                /*
+                    Advance the notifier timer rather than waking the event service to recompute its delay
+                 */
+                if (es->waiting && mprSetWaitTimer(MPR->waitService, event->due - mprGetTicks()) == 0) {
+                    es->willAwake = event->due;
+                    mustWakeWaitService = 0;
+                }
+#endif
             }
         } else {
-            queueDispatcher(es->readyQ, dispatcher);
+            queueDispatcher(es->readyQ[dispatcher->priority], dispatcher);
             mustWakeWaitService = es->waiting;
             mustWakeCond = dispatcher->flags & MPR_DISPATCHER_WAITING;
         }
     }
+    if (es->spinning) {
+        /*
+            The event loop is polling without blocking and will see the dispatcher on its next pass
+         */
+        mustWakeWaitService = 0;
+    }
     unlock(es);
     if (mustWakeCond) {
         mprSignalDispatcher(dispatcher);
@@ -482,6 +833,8 @@ static int dispatchEvents(MprDispatcher *dispatcher)
     MprEventService     *es;
     MprEvent            *event;
     MprOsThread         priorOwner;
+    MprTicks            delay;
+    uint64              start;
     int                 count;
 
     assert(isRunning(dispatcher));
@@ -503,10 +856,22 @@ static int dispatchEvents(MprDispatcher *dispatcher)
         assert(!(event->flags & MPR_EVENT_RUNNING));
         event->flags |= MPR_EVENT_RUNNING;
         assert(event->proc);
+        if (es->statsEnabled) {
+            if (!dispatcher->stats) {
+                dispatcher->stats = mprAllocStruct(MprEventStats);
+            }
+            delay = max(mprGetTicks() - event->due, 0);
+            start = mprGetMicroTicks();
+        } else {
+            start = 0;
+        }
         (event->proc)(event->data, event);
         event->flags &= ~MPR_EVENT_RUNNING;
 
         lock(es);
+        if (start && es->statsEnabled) {
+            recordEvent(es, dispatcher, event->name, delay, start);
+        }
         if (event->flags & MPR_EVENT_CONTINUOUS) {
             /* Reschedule if continuous */
             event->timestamp = dispatcher->service->now;
@@ -526,10 +891,18 @@ static int dispatchEvents(MprDispatcher *dispatcher)
 
 /*
     Run events for a dispatcher in a worker thread. When complete, reschedule the dispatcher as required.
+    Sticky dispatchers remember the worker and run follow-up events before releasing it. The worker is NULL when 
+    run immediately on the event service thread.
  */
-static void dispatchEventsWorker(MprDispatcher *dispatcher)
+static void dispatchEventsWorker(MprDispatcher *dispatcher, MprWorker *worker)
 {
-    dispatchEvents(dispatcher);
+    int     count;
+
+    count = dispatchEvents(dispatcher);
+    if (worker && (dispatcher->flags & MPR_DISPATCHER_STICKY)) {
+        dispatcher->worker = worker;
+        drainEvents(dispatcher, count);
+    }
     if (!(dispatcher->flags == MPR_DISPATCHER_DESTROYED)) {
         dequeueDispatcher(dispatcher);
         mprScheduleDispatcher(dispatcher);
@@ -537,6 +910,59 @@ static void dispatchEventsWorker(MprDispatcher *dispatcher)
 }
 
 
+/*
+    Run follow-up events on the current worker up to the batch count. Wait up to the batch time for new events. 
+    The dispatcher stays on the runQ so mprScheduleDispatcher signals the dispatcher cond rather than queueing it for 
+    another worker. Stop if another thread is waiting in mprWaitForEvent and pass on any wakeup.
+ */
+static void drainEvents(MprDispatcher *dispatcher, int count)
+{
+    MprEventService     *es;
+    MprTicks            expires, delay;
+    MprOsThread         priorOwner;
+    int                 nevents;
+
+    es = dispatcher->service;
+    priorOwner = dispatcher->owner;
+    dispatcher->owner = mprGetCurrentOsThread();
+    es->now = mprGetTicks();
+    expires = es->now + es->batchTime;
+
+    while (count < es->batchCount && !mprIsStoppingCore()) {
+        lock(es);
+        if (dispatcher->flags & (MPR_DISPATCHER_DESTROYED | MPR_DISPATCHER_WAITING)) {
+            unlock(es);
+            break;
+        }
+        delay = getDispatcherIdleTicks(dispatcher, expires - es->now);
+        if (delay > 0) {
+            dispatcher->flags |= MPR_DISPATCHER_LINGER;
+        }
+        unlock(es);
+        if (delay > 0) {
+            mprYield(MPR_YIELD_STICKY);
+            mprWaitForCond(dispatcher->cond, delay);
+            mprResetYield();
+            lock(es);
+            dispatcher->flags &= ~MPR_DISPATCHER_LINGER;
+            unlock(es);
+            if (dispatcher->flags & MPR_DISPATCHER_DESTROYED) {
+                break;
+            }
+        }
+        es->now = mprGetTicks();
+        if ((nevents = dispatchEvents(dispatcher)) == 0 && es->now >= expires) {
+            break;
+        }
+        count += nevents;
+    }
+    dispatcher->owner = priorOwner;
+    if (dispatcher->flags & MPR_DISPATCHER_WAITING) {
+        mprSignalDispatcher(dispatcher);
+    }
+}
+
+
 PUBLIC void mprWakePendingDispatchers()
 {
     MprEventService *es;
@@ -553,57 +979,139 @@ PUBLIC void mprWakePendingDispatchers()
 }
 
 
+/*
+    Return how long the oldest dispatcher pending for a worker has been waiting
+ */
+PUBLIC MprTicks mprGetPendingDispatcherDelay()
+{
+    MprEventService *es;
+    MprDispatcher   *dp;
+    MprEvent        *event;
+    MprTicks        now, delay;
+
+    es = MPR->eventService;
+    now = mprGetTicks();
+    delay = 0;
+    lock(es);
+    for (dp = es->pendingQ->next; dp != es->pendingQ; dp = dp->next) {
+        if ((event = dp->eventQ->next) != dp->eventQ) {
+            delay = max(delay, now - event->due);
+        }
+    }
+    unlock(es);
+    return delay;
+}
+
+
 /*
     Get the next (ready) dispatcher off given runQ and move onto the runQ
  */
 static MprDispatcher *getNextReadyDispatcher(MprEventService *es)
 {
-    MprDispatcher   *dp, *next, *pendingQ, *readyQ, *waitQ, *dispatcher;
+    MprDispatcher   *dp, *next, *pendingQ, *waitQ, *dispatcher;
     MprEvent        *event;
 
     waitQ = es->waitQ;
-    readyQ = es->readyQ;
     pendingQ = es->pendingQ;
     dispatcher = 0;
 
     lock(es);
     if (pendingQ->next != pendingQ && mprAvailableWorkers() > 0) {
-        dispatcher = pendingQ->next;
-
-    } else if (readyQ->next == readyQ) {
         /*
-            ReadyQ is empty, try to transfer a dispatcher with due events onto the readyQ
+            Take the highest priority pending dispatcher that is permitted to start a worker
+         */
+        for (dp = pendingQ->next; dp != pendingQ; dp = dp->next) {
+            if ((!dispatcher || dp->priority < dispatcher->priority) && canStartWorker(es, dp)) {
+                dispatcher = dp;
+            }
+        }
+    }
+    if (!dispatcher && !hasReadyDispatchers(es)) {
+        /*
+            ReadyQs are empty, try to transfer a dispatcher with due events onto a readyQ
          */
         for (dp = waitQ->next; dp != waitQ; dp = next) {
             next = dp->next;
             event = dp->eventQ->next;
             if (event->due <= es->now) {
-                queueDispatcher(es->readyQ, dp);
+                queueDispatcher(es->readyQ[dp->priority], dp);
                 break;
             }
         }
     }
-    if (!dispatcher && readyQ->next != readyQ) {
-        dispatcher = readyQ->next;
+    if (!dispatcher) {
+        dispatcher = selectReadyDispatcher(es);
     }
     unlock(es);
     return dispatcher;
 }
 
 
+/*
+    Select a ready dispatcher using weighted round-robin over the priority classes. Each class may run up to its
+    weight of dispatchers per round. A new round starts when no class with ready dispatchers has credit remaining.
+    Must be called locked.
+ */
+static MprDispatcher *selectReadyDispatcher(MprEventService *es)
+{
+    MprDispatcher   *readyQ;
+    int             pass, pri;
+
+    for (pass = 0; pass < 2; pass++) {
+        for (pri = 0; pri < MPR_DISPATCHER_CLASSES; pri++) {
+            readyQ = es->readyQ[pri];
+            if (readyQ->next != readyQ && es->credit[pri] > 0) {
+                es->credit[pri]--;
+                return readyQ->next;
+            }
+        }
+        for (pri = 0; pri < MPR_DISPATCHER_CLASSES; pri++) {
+            es->credit[pri] = es->weight[pri];
+        }
+    }
+    return 0;
+}
+
+
+static bool hasReadyDispatchers(MprEventService *es)
+{
+    int     pri;
+
+    for (pri = 0; pri < MPR_DISPATCHER_CLASSES; pri++) {
+        if (es->readyQ[pri]->next != es->readyQ[pri]) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+
+/*
+    Test if a dispatcher may start a worker without consuming workers reserved for higher priority classes
+ */
+static bool canStartWorker(MprEventService *es, MprDispatcher *dispatcher)
+{
+    int     pri, reserved;
+
+    for (reserved = 0, pri = 0; pri < dispatcher->priority; pri++) {
+        reserved += es->reserve[pri];
+    }
+    return reserved == 0 || mprAvailableWorkers() > reserved;
+}
+
+
 /*
     Get the time to sleep till the next pending event. Must be called locked.
  */
 static MprTicks getIdleTicks(MprEventService *es, MprTicks timeout)
 {
-    MprDispatcher   *readyQ, *waitQ, *dp;
+    MprDispatcher   *waitQ, *dp;
     MprEvent        *event;
     MprTicks        delay;
 
     waitQ = es->waitQ;
-    readyQ = es->readyQ;
 
-    if (readyQ->next != readyQ) {
+    if (hasReadyDispatchers(es)) {
         delay = 0;
     } else if (mprIsStopping()) {
         delay = 10;
@@ -25,11 +25,6 @@ PUBLIC int mprCreateNotifierService(MprWaitService *ws)
     if ((ws->handlerMap = mprCreateList(MPR_FD_MIN, 0)) == 0) {
         return MPR_ERR_CANT_INITIALIZE;
     }
-    if ((ws->epoll = epoll_create(BIT_MAX_EVENTS)) < 0) {
-        mprError("Call to epoll() failed");
-        return MPR_ERR_CANT_INITIALIZE;
-    }
-
 #if defined(EFD_NONBLOCK)
     if ((ws->breakFd[MPR_READ_PIPE] = eventfd(0, 0)) < 0) {
         mprError("Cannot open breakout event");
@@ -47,16 +42,46 @@ PUBLIC int mprCreateNotifierService(MprWaitService *ws)
     fcntl(ws->breakFd[0], F_SETFL, fcntl(ws->breakFd[0], F_GETFL) | O_NONBLOCK);
     fcntl(ws->breakFd[1], F_SETFL, fcntl(ws->breakFd[1], F_GETFL) | O_NONBLOCK);
 #endif
+    ws->timerFd = -1;
+#if MPR_EVENT_IO_URING
+    if (mprCreateUring(ws) == 0) {
+        return 0;
+    }
+    mprLog(2, "io_uring is not supported by the kernel, using epoll");
+#endif
+    if ((ws->epoll = epoll_create(BIT_MAX_EVENTS)) < 0) {
+        mprError("Call to epoll() failed");
+        return MPR_ERR_CANT_INITIALIZE;
+    }
     memset(&ev, 0, sizeof(ev));
     ev.events = EPOLLIN | EPOLLERR | EPOLLHUP;
     ev.data.fd = ws->breakFd[MPR_READ_PIPE];
     epoll_ctl(ws->epoll, EPOLL_CTL_ADD, ws->breakFd[MPR_READ_PIPE], &ev);
+
+#if MPR_WAIT_TIMER
+    /*
+        The timerfd is armed for the next due event. This gives exact timer expiry and permits other threads to 
+        advance the wakeup time without writing to the break event.
+     */
+    if ((ws->timerFd = timerfd_create(CLOCK_MONOTONIC, TFD_NONBLOCK | TFD_CLOEXEC)) >= 0) {
+        memset(&ev, 0, sizeof(ev));
+        ev.events = EPOLLIN;
+        ev.data.fd = ws->timerFd;
+        if (epoll_ctl(ws->epoll, EPOLL_CTL_ADD, ws->timerFd, &ev) < 0) {
+            close(ws->timerFd);
+            ws->timerFd = -1;
+        }
+    }
+#endif
     return 0;
 }
 
 
 PUBLIC void mprManageEpoll(MprWaitService *ws, int flags)
 {
+#if MPR_EVENT_IO_URING
+    mprManageUring(ws, flags);
+#endif
     if (flags & MPR_MANAGE_MARK) {
         mprMark(ws->handlerMap);
 
@@ -71,6 +96,10 @@ PUBLIC void mprManageEpoll(MprWaitService *ws, int flags)
         if (ws->breakFd[1] >= 0) {
             close(ws->breakFd[1]);
         }
+        if (ws->timerFd >= 0) {
+            close(ws->timerFd);
+            ws->timerFd = -1;
+        }
     }
 }
 
@@ -81,6 +110,11 @@ PUBLIC int mprNotifyOn(MprWaitService *ws, MprWaitHandler *wp, int mask)
     int                 fd, rc;
 
     assert(wp);
+#if MPR_EVENT_IO_URING
+    if (ws->ring) {
+        return mprUringNotifyOn(ws, wp, mask);
+    }
+#endif
     fd = wp->fd;
 
     lock(ws);
@@ -183,6 +217,12 @@ PUBLIC void mprWaitForIO(MprWaitService *ws, MprTicks timeout)
     struct epoll_event  events[BIT_MAX_EVENTS];
     int                 nevents;
 
+#if MPR_EVENT_IO_URING
+    if (ws->ring) {
+        mprUringWaitForIO(ws, timeout);
+        return;
+    }
+#endif
     if (timeout < 0 || timeout > MAXINT) {
         timeout = MAXINT;
     }
@@ -227,6 +267,11 @@ static void serviceIO(MprWaitService *ws, struct epoll_event *events, int count)
             if (read(fd, buf, sizeof(buf)) < 0) {}
             continue;
         }
+        if (fd == ws->timerFd) {
+            uint64 expirations;
+            if (read(fd, &expirations, sizeof(expirations)) < 0) {}
+            continue;
+        }
         if (fd < 0 || (wp = mprGetItem(ws->handlerMap, fd)) == 0) {
             /*
                 This can happen if a writable event has been triggered (e.g. MprCmd command stdin pipe) and the pipe is closed.
@@ -261,6 +306,34 @@ static void serviceIO(MprWaitService *ws, struct epoll_event *events, int count)
 }
 
 
+#if MPR_WAIT_TIMER
+/*
+    Arm the timer to expire after the given delay in milliseconds. This replaces any prior setting. 
+    Called by the event service with the event service locked. Returns MPR_ERR_BAD_STATE if the timer is not available.
+ */
+PUBLIC int mprSetWaitTimer(MprWaitService *ws, MprTicks delay)
+{
+    struct itimerspec   spec;
+
+    if (ws->timerFd < 0) {
+        return MPR_ERR_BAD_STATE;
+    }
+    memset(&spec, 0, sizeof(spec));
+    if (delay <= 0) {
+        /* A zero value would disarm the timer */
+        spec.it_value.tv_nsec = 1;
+    } else {
+        spec.it_value.tv_sec = (time_t) (delay / 1000);
+        spec.it_value.tv_nsec = (long) ((delay % 1000) * 1000 * 1000);
+    }
+    if (timerfd_settime(ws->timerFd, 0, &spec, NULL) < 0) {
+        return MPR_ERR_BAD_STATE;
+    }
+    return 0;
+}
+#endif
+
+
 /*
     Wake the wait service. WARNING: This routine must not require locking. MprEvents in scheduleDispatcher depends on this.
     Must be async-safe.
@@ -12,9 +12,12 @@
 
 /***************************** Forward Declarations ***************************/
 
+static void cancelDeadline(MprDeadline *deadline);
+static void deadlineTimer(MprDeadline *deadline, MprEvent *event);
 static void initEvent(MprDispatcher *dispatcher, MprEvent *event, cchar *name, MprTicks period, void *proc, 
         void *data, int flgs);
 static void initEventQ(MprEvent *q);
+static void manageDeadline(MprDeadline *deadline, int flags);
 static void manageEvent(MprEvent *event, int flags);
 static void queueEvent(MprEvent *prior, MprEvent *event);
 
@@ -302,6 +305,195 @@ PUBLIC void mprDequeueEvent(MprEvent *event)
 }
 
 
+/*
+    Create a deadline for the dispatcher. The expiry timer runs on the non-blocking dispatcher so it fires even while
+    the governed dispatcher is blocked in mprWaitForEvent or on a worker thread.
+ */
+PUBLIC MprDeadline *mprCreateDeadline(MprDispatcher *dispatcher, MprTicks timeout)
+{
+    MprDeadline     *deadline;
+
+    if (dispatcher == 0) {
+        dispatcher = MPR->dispatcher;
+    }
+    if ((deadline = mprAllocObj(MprDeadline, manageDeadline)) == 0) {
+        return 0;
+    }
+    deadline->dispatcher = dispatcher;
+    deadline->sockets = mprCreateList(0, 0);
+    if (dispatcher->deadline) {
+        mprRemoveDeadline(dispatcher->deadline);
+    }
+    dispatcher->deadline = deadline;
+    mprResetDeadline(deadline, timeout);
+    return deadline;
+}
+
+
+static void manageDeadline(MprDeadline *deadline, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(deadline->timer);
+        mprMark(deadline->dispatcher);
+        mprMark(deadline->sockets);
+    }
+}
+
+
+PUBLIC void mprResetDeadline(MprDeadline *deadline, MprTicks timeout)
+{
+    if (deadline == 0 || deadline->expired) {
+        return;
+    }
+    if (timeout < 0) {
+        timeout = MPR_MAX_TIMEOUT;
+    }
+    if (deadline->timer) {
+        mprRemoveEvent(deadline->timer);
+    }
+    deadline->expires = mprGetTicks() + timeout;
+    deadline->timer = mprCreateEvent(NULL, "deadline", timeout, deadlineTimer, deadline, MPR_EVENT_QUICK);
+}
+
+
+PUBLIC void mprRemoveDeadline(MprDeadline *deadline)
+{
+    if (deadline == 0) {
+        return;
+    }
+    if (deadline->timer) {
+        mprRemoveEvent(deadline->timer);
+        deadline->timer = 0;
+    }
+    if (deadline->dispatcher && deadline->dispatcher->deadline == deadline) {
+        deadline->dispatcher->deadline = 0;
+    }
+}
+
+
+PUBLIC void mprCancelDeadline(MprDeadline *deadline)
+{
+    if (deadline && !deadline->expired) {
+        cancelDeadline(deadline);
+    }
+}
+
+
+PUBLIC void mprAddDeadlineSocket(MprDeadline *deadline, MprSocket *sp)
+{
+    if (deadline && sp) {
+        mprAddItem(deadline->sockets, sp);
+    }
+}
+
+
+PUBLIC bool mprIsDeadlineExpired(MprDeadline *deadline)
+{
+    return deadline && deadline->expired;
+}
+
+
+PUBLIC MprTicks mprGetDeadlineRemaining(MprDeadline *deadline)
+{
+    if (deadline == 0) {
+        return MPR_MAX_TIMEOUT;
+    }
+    if (deadline->expired) {
+        return 0;
+    }
+    return max(deadline->expires - mprGetTicks(), 0);
+}
+
+
+static void deadlineTimer(MprDeadline *deadline, MprEvent *event)
+{
+    if (event == deadline->timer && !deadline->expired) {
+        cancelDeadline(deadline);
+    }
+}
+
+
+/*
+    Cancel the operations of the dispatcher governed by the deadline. Pending events are removed unless created with
+    MPR_EVENT_NO_CANCEL. Running continuous events are not rescheduled. I/O events are left so wait handlers see the
+    socket shutdown.
+ */
+static void cancelDeadline(MprDeadline *deadline)
+{
+    MprEventService     *es;
+    MprDispatcher       *dispatcher;
+    MprEvent            *q, *event, *nextEvent;
+    MprSocket           *sp;
+    MprCmd              *cmd;
+    int                 next;
+
+    /* The deadline timer and a waiter reaching the deadline may race to cancel */
+    es = MPR->eventService;
+    lock(es);
+    if (deadline->expired) {
+        unlock(es);
+        return;
+    }
+    deadline->expired = 1;
+    unlock(es);
+    deadline->expires = min(deadline->expires, mprGetTicks());
+    if (deadline->timer) {
+        mprRemoveEvent(deadline->timer);
+        deadline->timer = 0;
+    }
+    if ((dispatcher = deadline->dispatcher) == 0 || dispatcher->deadline != deadline) {
+        return;
+    }
+    mprTrace(5, "Deadline expired for dispatcher %s", dispatcher->name);
+
+    lock(es);
+    q = dispatcher->eventQ;
+    for (event = q->next; event != q; event = nextEvent) {
+        nextEvent = event->next;
+        if (!event->handler && !(event->flags & MPR_EVENT_NO_CANCEL)) {
+            mprDequeueEvent(event);
+            event->dispatcher = 0;
+            event->flags &= ~MPR_EVENT_CONTINUOUS;
+        }
+    }
+    /*
+        Events on the currentQ are running and cannot be interrupted. Clear the continuous flag so dispatchEvents
+        does not reschedule them. They are removed from the currentQ when their callbacks return.
+     */
+    q = dispatcher->currentQ;
+    for (event = q->next; event != q; event = event->next) {
+        if (!(event->flags & MPR_EVENT_NO_CANCEL)) {
+            event->flags &= ~MPR_EVENT_CONTINUOUS;
+        }
+    }
+    mprScheduleDispatcher(dispatcher);
+    unlock(es);
+
+    for (ITERATE_ITEMS(deadline->sockets, sp, next)) {
+        lock(sp);
+        if (!(sp->flags & MPR_SOCKET_CLOSED) && sp->fd != INVALID_SOCKET) {
+            shutdown(sp->fd, SHUT_RDWR);
+            if (sp->handler) {
+                mprRecallWaitHandler(sp->handler);
+            }
+        }
+        unlock(sp);
+    }
+    mprClearList(deadline->sockets);
+
+    if (MPR->cmdService) {
+        lock(MPR->cmdService);
+        for (ITERATE_ITEMS(MPR->cmdService->cmds, cmd, next)) {
+            if (cmd->dispatcher == dispatcher && !cmd->complete) {
+                mprStopCmd(cmd, -1);
+            }
+        }
+        unlock(MPR->cmdService);
+    }
+    mprSignalDispatcher(dispatcher);
+}
+
+
 /*
     @copy   default
 
@@ -0,0 +1,390 @@
+/**
+    fiber.c - Stackful coroutines run by dispatchers
+
+    A fiber runs a procedure on its own stack. The fiber is started and resumed by events on its dispatcher and it
+    suspends itself by switching back to the context of the event that resumed it. Dispatchers run one event at a 
+    time, so fiber state is only modified while running on the fiber dispatcher. The exception is mprResumeFiber 
+    which queues an event to the dispatcher. This module is thread-safe.
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************* Includes ***********************************/
+
+#include    "mpr.h"
+
+#if MPR_FIBER
+/*********************************** Locals ***********************************/
+
+/*
+    Fiber running on the current thread
+ */
+static MprThreadLocal *fiberLocal;
+
+/***************************** Forward Declarations ***************************/
+
+static void createFailed(MprFiber *fiber);
+static void fiberMain(uint lo, uint hi);
+static void ioFiber(MprFiber *fiber, MprEvent *event);
+static void manageFiber(MprFiber *fiber, int flags);
+static void releaseFiber(MprFiber *fiber, MprEvent *event);
+static void resumeFiber(MprFiber *fiber);
+static void signalFiber(MprFiber *fiber, MprEvent *event);
+static void startFiber(MprFiber *fiber, MprEvent *event);
+static void timeoutFiber(MprFiber *fiber, MprEvent *event);
+static void waitFiber(MprFiber *fiber, MprTicks timeout);
+
+/************************************* Code ***********************************/
+
+PUBLIC MprFiber *mprCreateFiber(MprDispatcher *dispatcher, MprFiberProc proc, void *data, ssize stackSize)
+{
+    MprFiber    *fiber;
+    ssize       pageSize;
+
+    assert(proc);
+
+    if (fiberLocal == 0) {
+        mprGlobalLock();
+        if (fiberLocal == 0) {
+            fiberLocal = mprCreateThreadLocal();
+            mprAddRoot(fiberLocal);
+        }
+        mprGlobalUnlock();
+    }
+    if ((fiber = mprAllocObj(MprFiber, manageFiber)) == 0) {
+        return 0;
+    }
+    if (dispatcher == 0) {
+        if ((fiber->dispatcher = mprCreateDispatcher("fiber", 0)) == 0) {
+            return 0;
+        }
+        fiber->ownDispatcher = 1;
+    } else {
+        fiber->dispatcher = dispatcher;
+    }
+    fiber->proc = proc;
+    fiber->data = data;
+
+    /*
+        Reserve an extra page at the bottom of the stack as a guard page to trap stack overflow
+     */
+    pageSize = mprGetPageSize();
+    fiber->stackSize = MPR_PAGE_ALIGN(stackSize > 0 ? stackSize : MPR_FIBER_STACK, pageSize) + pageSize;
+    if ((fiber->stack = mprVirtAlloc(fiber->stackSize, MPR_MAP_READ | MPR_MAP_WRITE)) == 0) {
+        createFailed(fiber);
+        return 0;
+    }
+    mprotect(fiber->stack, pageSize, PROT_NONE);
+
+    /*
+        Only the fiber object is used after getcontext so no locals are subject to clobbering
+     */
+    if (getcontext(&fiber->context) < 0) {
+        createFailed(fiber);
+        return 0;
+    }
+    fiber->context.uc_stack.ss_sp = fiber->stack;
+    fiber->context.uc_stack.ss_size = fiber->stackSize;
+    fiber->context.uc_link = &fiber->caller;
+    makecontext(&fiber->context, (void (*)()) fiberMain, 2, (uint) (uint64) fiber, (uint) (((uint64) fiber) >> 32));
+
+    /*
+        The fiber is retained until its procedure returns
+     */
+    fiber->state = MPR_FIBER_READY;
+    mprAddRoot(fiber);
+    mprCreateEvent(fiber->dispatcher, "fiberStart", 0, startFiber, fiber, MPR_EVENT_NO_CANCEL);
+    return fiber;
+}
+
+
+/*
+    Release resources of a fiber that could not be created
+ */
+static void createFailed(MprFiber *fiber)
+{
+    if (fiber->stack) {
+        mprVirtFree(fiber->stack, fiber->stackSize);
+        fiber->stack = 0;
+    }
+    if (fiber->ownDispatcher) {
+        mprDestroyDispatcher(fiber->dispatcher);
+        fiber->dispatcher = 0;
+    }
+}
+
+
+static void manageFiber(MprFiber *fiber, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(fiber->data);
+        mprMark(fiber->dispatcher);
+        mprMark(fiber->timer);
+
+    } else if (flags & MPR_MANAGE_FREE) {
+        if (fiber->stack) {
+            mprVirtFree(fiber->stack, fiber->stackSize);
+            fiber->stack = 0;
+        }
+    }
+}
+
+
+PUBLIC MprFiber *mprGetCurrentFiber()
+{
+    return fiberLocal ? mprGetThreadData(fiberLocal) : 0;
+}
+
+
+PUBLIC int mprAwaitEvent(MprTicks timeout)
+{
+    MprFiber    *fiber;
+
+    if ((fiber = mprGetCurrentFiber()) == 0) {
+        return MPR_ERR_BAD_STATE;
+    }
+    if (fiber->signalled) {
+        fiber->signalled = 0;
+        lock(MPR->eventService);
+        fiber->result = fiber->value;
+        unlock(MPR->eventService);
+        return fiber->result;
+    }
+    fiber->waitMask = 0;
+    fiber->result = MPR_ERR_TIMEOUT;
+    waitFiber(fiber, timeout);
+    return fiber->result;
+}
+
+
+PUBLIC int mprAwaitIO(MprSocket *sp, int mask, MprTicks timeout)
+{
+    MprFiber        *fiber;
+    MprWaitHandler  *wp;
+
+    if ((fiber = mprGetCurrentFiber()) == 0) {
+        return MPR_ERR_BAD_STATE;
+    }
+    if (mask == 0 || sp->fd == INVALID_SOCKET) {
+        return MPR_ERR_BAD_ARGS;
+    }
+    /*
+        Reuse the socket wait handler from prior waits if it uses the fiber dispatcher
+     */
+    if ((wp = sp->handler) != 0) {
+        if (wp->proc != (MprEventProc) ioFiber) {
+            return MPR_ERR_BAD_STATE;
+        }
+        if (wp->dispatcher != fiber->dispatcher) {
+            mprRemoveSocketHandler(sp);
+            wp = 0;
+        }
+    }
+    if (wp) {
+        wp->handlerData = fiber;
+        mprWaitOn(wp, mask);
+    } else if ((wp = mprAddSocketHandler(sp, mask, fiber->dispatcher, ioFiber, fiber, 0)) == 0) {
+        return MPR_ERR_CANT_OPEN;
+    }
+    fiber->waitMask = mask;
+    fiber->result = 0;
+    waitFiber(fiber, timeout);
+    fiber->waitMask = 0;
+    if (fiber->result == 0) {
+        mprWaitOn(wp, 0);
+    }
+    return fiber->result;
+}
+
+
+/*
+    Resume a fiber from any thread. The fiber is resumed by an event on its dispatcher.
+ */
+PUBLIC void mprResumeFiber(MprFiber *fiber, int value)
+{
+    MprEventService     *es;
+
+    if (fiber) {
+        /*
+            The value is read by signalFiber on the fiber dispatcher. Set it under the event service lock which is 
+            also taken when the resume event is queued.
+         */
+        es = MPR->eventService;
+        lock(es);
+        fiber->value = value;
+        unlock(es);
+        mprCreateEvent(fiber->dispatcher, "fiberResume", 0, signalFiber, fiber, MPR_EVENT_NO_CANCEL);
+    }
+}
+
+
+/*
+    Suspend the current fiber until resumed by an I/O, signal or timeout event
+ */
+static void waitFiber(MprFiber *fiber, MprTicks timeout)
+{
+    MprDeadline     *deadline;
+
+    if ((deadline = fiber->dispatcher->deadline) != 0) {
+        timeout = (timeout < 0) ? mprGetDeadlineRemaining(deadline) : min(timeout, mprGetDeadlineRemaining(deadline));
+    }
+    if (timeout >= 0) {
+        fiber->timer = mprCreateEvent(fiber->dispatcher, "fiberTimeout", timeout, timeoutFiber, fiber, 
+            MPR_EVENT_NO_CANCEL);
+    }
+    fiber->state = MPR_FIBER_WAITING;
+    swapcontext(&fiber->context, &fiber->caller);
+
+    if (fiber->timer) {
+        mprRemoveEvent(fiber->timer);
+        fiber->timer = 0;
+    }
+}
+
+
+/*
+    Switch to the fiber. This returns when the fiber waits or its procedure returns.
+ */
+static void resumeFiber(MprFiber *fiber)
+{
+    MprFiber    *prior;
+
+    prior = mprGetThreadData(fiberLocal);
+    mprSetThreadData(fiberLocal, fiber);
+    fiber->state = MPR_FIBER_RUNNING;
+    swapcontext(&fiber->caller, &fiber->context);
+    mprSetThreadData(fiberLocal, prior);
+
+    if (fiber->state == MPR_FIBER_COMPLETE) {
+        mprVirtFree(fiber->stack, fiber->stackSize);
+        fiber->stack = 0;
+        mprRemoveRoot(fiber);
+        if (fiber->ownDispatcher) {
+            /* This is running on the fiber dispatcher, so destroy it from an event on another dispatcher */
+            mprCreateEvent(NULL, "fiberRelease", 0, releaseFiber, fiber, MPR_EVENT_QUICK | MPR_EVENT_NO_CANCEL);
+        }
+    }
+}
+
+
+/*
+    Destroy the dispatcher created for a completed fiber
+ */
+static void releaseFiber(MprFiber *fiber, MprEvent *event)
+{
+    if (fiber->ownDispatcher) {
+        mprDestroyDispatcher(fiber->dispatcher);
+        fiber->ownDispatcher = 0;
+    }
+}
+
+
+/*
+    Fiber entry point. The fiber reference is passed as two 32-bit arguments as makecontext only supports int arguments.
+    On return, the fiber switches to the uc_link caller context.
+ */
+static void fiberMain(uint lo, uint hi)
+{
+    MprFiber    *fiber;
+
+    fiber = (MprFiber*) (((uint64) hi << 32) | (uint64) lo);
+    (fiber->proc)(fiber->data);
+    fiber->state = MPR_FIBER_COMPLETE;
+}
+
+
+static void startFiber(MprFiber *fiber, MprEvent *event)
+{
+    if (fiber->state == MPR_FIBER_READY) {
+        resumeFiber(fiber);
+    }
+}
+
+
+static void ioFiber(MprFiber *fiber, MprEvent *event)
+{
+    if (fiber->state == MPR_FIBER_WAITING && fiber->waitMask) {
+        fiber->result = event->mask;
+        resumeFiber(fiber);
+    }
+}
+
+
+static void signalFiber(MprFiber *fiber, MprEvent *event)
+{
+    MprEventService     *es;
+
+    if (fiber->state == MPR_FIBER_WAITING && fiber->waitMask == 0) {
+        es = MPR->eventService;
+        lock(es);
+        fiber->result = fiber->value;
+        unlock(es);
+        resumeFiber(fiber);
+
+    } else if (fiber->state != MPR_FIBER_COMPLETE) {
+        fiber->signalled = 1;
+    }
+}
+
+
+static void timeoutFiber(MprFiber *fiber, MprEvent *event)
+{
+    if (event == fiber->timer) {
+        fiber->timer = 0;
+        if (fiber->state == MPR_FIBER_WAITING) {
+            resumeFiber(fiber);
+        }
+    }
+}
+
+#else /* MPR_FIBER */
+
+PUBLIC MprFiber *mprCreateFiber(MprDispatcher *dispatcher, MprFiberProc proc, void *data, ssize stackSize)
+{
+    return 0;
+}
+
+
+PUBLIC MprFiber *mprGetCurrentFiber()
+{
+    return 0;
+}
+
+
+PUBLIC int mprAwaitEvent(MprTicks timeout)
+{
+    return MPR_ERR_BAD_STATE;
+}
+
+
+PUBLIC int mprAwaitIO(MprSocket *sp, int mask, MprTicks timeout)
+{
+    return MPR_ERR_BAD_STATE;
+}
+
+
+PUBLIC void mprResumeFiber(MprFiber *fiber, int value)
+{
+}
+
+#endif /* MPR_FIBER */
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software LLC, 2003-2013. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a 
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
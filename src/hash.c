@@ -5,8 +5,9 @@
     are arbitrary pointers. The keys are hashed into a series of buckets which then have a chain of hash entries.
     The chain in in collating sequence so search time through the chain is on average (N/hashSize)/2.
 
-    This module is not thread-safe. It is the callers responsibility to perform all thread synchronization.
-    There is locking solely for the purpose of synchronization with the GC marker()
+    Updates take a write lock and lookups take a read lock, so concurrent lookups do not serialize. Tables that are 
+    rarely updated should be created with MPR_HASH_READ_MOSTLY. Iteration is not locked and it is the callers 
+    responsibility to synchronize iteration with updates.
 
     Copyright (c) All Rights Reserved. See details at the end of the file.
  */
@@ -24,6 +25,7 @@
 /********************************** Forwards **********************************/
 
 static void *dupKey(MprHash *hash, cvoid *key);
+static void growHash(MprHash *hash);
 static MprKey *lookupHash(int *index, MprKey **prevSp, MprHash *hash, cvoid *key);
 static void manageHashTable(MprHash *hash, int flags);
 
@@ -49,9 +51,9 @@ PUBLIC MprHash *mprCreateHash(int hashSize, int flags)
     hash->size = hashSize;
     hash->length = 0;
     if (!(flags & MPR_HASH_OWN)) {
-        hash->mutex = mprCreateLock();
+        hash->rwlock = mprCreateRWLock((flags & MPR_HASH_READ_MOSTLY) ? MPR_RWLOCK_PERCPU : 0);
     } else {
-        hash->mutex = 0;
+        hash->rwlock = 0;
     }
 #if BIT_CHAR_LEN > 1 && KEEP
     if (hash->flags & MPR_HASH_UNICODE) {
@@ -79,9 +81,9 @@ static void manageHashTable(MprHash *hash, int flags)
     int         i;
 
     if (flags & MPR_MANAGE_MARK) {
-        mprMark(hash->mutex);
+        mprMark(hash->rwlock);
         mprMark(hash->buckets);
-        lock(hash);
+        mprReadLock(hash->rwlock);
         for (i = 0; i < hash->size; i++) {
             for (sp = (MprKey*) hash->buckets[i]; sp; sp = sp->next) {
                 mprMark(sp);
@@ -100,7 +102,7 @@ static void manageHashTable(MprHash *hash, int flags)
                 }
             }
         }
-        unlock(hash);
+        mprReadUnlock(hash->rwlock);
     }
 }
 
@@ -118,24 +120,25 @@ PUBLIC MprKey *mprAddKey(MprHash *hash, cvoid *key, cvoid *ptr)
         assert(hash);
         return 0;
     }
-    lock(hash);
+    mprWriteLock(hash->rwlock);
+    growHash(hash);
     if ((sp = lookupHash(&index, &prevSp, hash, key)) != 0) {
         if (hash->flags & MPR_HASH_UNIQUE) {
-            unlock(hash);
+            mprWriteUnlock(hash->rwlock);
             return 0;
         }
         /*
             Already exists. Just update the data.
          */
         sp->data = ptr;
-        unlock(hash);
+        mprWriteUnlock(hash->rwlock);
         return sp;
     }
     /*
         Hash entries are managed by manageHashTable
      */
     if ((sp = mprAllocStructNoZero(MprKey)) == 0) {
-        unlock(hash);
+        mprWriteUnlock(hash->rwlock);
         return 0;
     }
     sp->data = ptr;
@@ -149,7 +152,7 @@ PUBLIC MprKey *mprAddKey(MprHash *hash, cvoid *key, cvoid *ptr)
     sp->next = hash->buckets[index];
     hash->buckets[index] = sp;
     hash->length++;
-    unlock(hash);
+    mprWriteUnlock(hash->rwlock);
     return sp;
 }
 
@@ -200,13 +203,14 @@ PUBLIC MprKey *mprAddDuplicateKey(MprHash *hash, cvoid *key, cvoid *ptr)
     } else {
         sp->key = (void*) key;
     }
-    lock(hash);
+    mprWriteLock(hash->rwlock);
+    growHash(hash);
     index = hash->fn(key, slen(key)) % hash->size;
     sp->bucket = index;
     sp->next = hash->buckets[index];
     hash->buckets[index] = sp;
     hash->length++;
-    unlock(hash);
+    mprWriteUnlock(hash->rwlock);
     return sp;
 }
 
@@ -219,9 +223,9 @@ PUBLIC int mprRemoveKey(MprHash *hash, cvoid *key)
     assert(hash);
     assert(key);
 
-    lock(hash);
+    mprWriteLock(hash->rwlock);
     if ((sp = lookupHash(&index, &prevSp, hash, key)) == 0) {
-        unlock(hash);
+        mprWriteUnlock(hash->rwlock);
         return MPR_ERR_CANT_FIND;
     }
     if (prevSp) {
@@ -230,7 +234,7 @@ PUBLIC int mprRemoveKey(MprHash *hash, cvoid *key)
         hash->buckets[index] = sp->next;
     }
     hash->length--;
-    unlock(hash);
+    mprWriteUnlock(hash->rwlock);
     return 0;
 }
 
@@ -273,7 +277,15 @@ PUBLIC MprHash *mprCloneHash(MprHash *master)
  */
 PUBLIC MprKey *mprLookupKeyEntry(MprHash *hash, cvoid *key)
 {
-    return lookupHash(0, 0, hash, key);
+    MprKey      *sp;
+
+    if (hash == 0) {
+        return 0;
+    }
+    mprReadLock(hash->rwlock);
+    sp = lookupHash(0, 0, hash, key);
+    mprReadUnlock(hash->rwlock);
+    return sp;
 }
 
 
@@ -283,11 +295,15 @@ PUBLIC MprKey *mprLookupKeyEntry(MprHash *hash, cvoid *key)
 PUBLIC void *mprLookupKey(MprHash *hash, cvoid *key)
 {
     MprKey      *sp;
+    void        *data;
 
-    if ((sp = lookupHash(0, 0, hash, key)) == 0) {
+    if (hash == 0) {
         return 0;
     }
-    return (void*) sp->data;
+    mprReadLock(hash->rwlock);
+    data = ((sp = lookupHash(0, 0, hash, key)) != 0) ? (void*) sp->data : 0;
+    mprReadUnlock(hash->rwlock);
+    return data;
 }
 
 
@@ -313,17 +329,14 @@ static int getHashSize(int numKeys)
 
 
 /*
-    This is unlocked because it is read-only
+    Grow the hash when it becomes too dense. Must be called with the write lock held.
  */
-static MprKey *lookupHash(int *bucketIndex, MprKey **prevSp, MprHash *hash, cvoid *key)
+static void growHash(MprHash *hash)
 {
-    MprKey      *sp, *prev, *next;
+    MprKey      *sp, *next;
     MprKey      **buckets;
-    int         hashSize, i, index, rc;
+    int         hashSize, i, index;
 
-    if (key == 0 || hash == 0) {
-        return 0;
-    }
     if (hash->length > hash->size) {
         hashSize = getHashSize(hash->length * 4 / 3);
         if (hash->size < hashSize) {
@@ -349,6 +362,20 @@ static MprKey *lookupHash(int *bucketIndex, MprKey **prevSp, MprHash *hash, cvoi
             }
         }
     }
+}
+
+
+/*
+    Callers must hold the read or write lock
+ */
+static MprKey *lookupHash(int *bucketIndex, MprKey **prevSp, MprHash *hash, cvoid *key)
+{
+    MprKey      *sp, *prev;
+    int         index, rc;
+
+    if (key == 0 || hash == 0) {
+        return 0;
+    }
     index = hash->fn(key, slen(key)) % hash->size;
     if (bucketIndex) {
         *bucketIndex = index;
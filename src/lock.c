@@ -11,19 +11,65 @@
 /***************************** Forward Declarations ***************************/
 
 static void manageLock(MprMutex *lock, int flags);
+static void manageRWLock(MprRWLock *lock, int flags);
+#if MPR_FUTEX
+static MprLockSite *findSite(void *caller);
+static int getSpinLimit();
+static void initMutex(MprMutex *lock, void *caller);
+static void lockContended(MprMutex *lock);
+static void rwPark(MprRWLock *lock, volatile int *addr, int value);
+static void rwWake(MprRWLock *lock, volatile int *addr);
+#endif
+static MprSpin *initSpinLock(MprSpin *lock, void *caller);
+
+/************************************ Locals **********************************/
+
+#if MPR_FUTEX
+static MprLockSite  lockSites[MPR_LOCK_SITES];
+static int          lockProfile;
+static int          lockSpin = -1;
+
+/*
+    Reader-writer lock state word
+ */
+#define RW_READERS      0xFFFF          /* Count of active readers (not per-cpu) */
+#define RW_WAITING      0x10000         /* Increment for each waiting writer */
+#define RW_WRITER       0x40000000      /* Writer holds the lock */
+
+/*
+    Per-cpu reader count. Padded so counts do not share a cache line.
+ */
+typedef struct MprRWSlot {
+    volatile int    count;
+    char            pad[60];
+} MprRWSlot;
+
+/*
+    Relax the cpu while spinning so a hyperthread sibling holding the lock can progress
+ */
+#if __i386__ || __x86_64__
+    #define cpuRelax() __asm__ __volatile__ ("pause" ::: "memory")
+#elif __aarch64__ || __arm__
+    #define cpuRelax() __asm__ __volatile__ ("yield" ::: "memory")
+#else
+    #define cpuRelax() __asm__ __volatile__ ("" ::: "memory")
+#endif
+#endif
 
 /************************************ Code ************************************/
 
 PUBLIC MprMutex *mprCreateLock()
 {
     MprMutex    *lock;
-#if BIT_UNIX_LIKE
+#if BIT_UNIX_LIKE && !MPR_FUTEX
     pthread_mutexattr_t attr;
 #endif
     if ((lock = mprAllocObjNoZero(MprMutex, manageLock)) == 0) {
         return 0;
     }
-#if BIT_UNIX_LIKE
+#if MPR_FUTEX
+    initMutex(lock, __builtin_return_address(0));
+#elif BIT_UNIX_LIKE
     pthread_mutexattr_init(&attr);
     pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE_NP);
     pthread_mutex_init(&lock->cs, &attr);
@@ -48,7 +94,9 @@ static void manageLock(MprMutex *lock, int flags)
 {
     if (flags & MPR_MANAGE_FREE) {
         assert(lock);
-#if BIT_UNIX_LIKE
+#if MPR_FUTEX
+        assert(lock->state == 0);
+#elif BIT_UNIX_LIKE
         pthread_mutex_destroy(&lock->cs);
 #elif BIT_WIN_LIKE
         DeleteCriticalSection(&lock->cs);
@@ -62,7 +110,10 @@ static void manageLock(MprMutex *lock, int flags)
 
 PUBLIC MprMutex *mprInitLock(MprMutex *lock)
 {
-#if BIT_UNIX_LIKE
+#if MPR_FUTEX
+    initMutex(lock, __builtin_return_address(0));
+
+#elif BIT_UNIX_LIKE
     pthread_mutexattr_t attr;
     pthread_mutexattr_init(&attr);
     pthread_mutexattr_settype(&attr, PTHREAD_MUTEX_RECURSIVE_NP);
@@ -92,11 +143,29 @@ PUBLIC MprMutex *mprInitLock(MprMutex *lock)
  */
 PUBLIC bool mprTryLock(MprMutex *lock)
 {
+#if MPR_FUTEX
+    MprOsThread     self;
+#endif
     int     rc;
 
     if (lock == 0) return 0;
 
-#if BIT_UNIX_LIKE
+#if MPR_FUTEX
+    self = mprGetCurrentOsThread();
+    if (lock->owner == self) {
+        lock->depth++;
+        return 1;
+    }
+    if (!__sync_bool_compare_and_swap(&lock->state, 0, 1)) {
+        return 0;
+    }
+    lock->owner = self;
+    lock->depth = 1;
+    if (lockProfile && lock->site) {
+        __sync_fetch_and_add(&lock->site->locks, 1);
+    }
+    rc = 0;
+#elif BIT_UNIX_LIKE
     rc = pthread_mutex_trylock(&lock->cs) != 0;
 #elif BIT_WIN_LIKE
     /* Rely on SpinCount being non-zero */
@@ -108,7 +177,7 @@ PUBLIC bool mprTryLock(MprMutex *lock)
 #elif VXWORKS
     rc = semTake(lock->cs, NO_WAIT) != OK;
 #endif
-#if BIT_DEBUG
+#if BIT_DEBUG && !MPR_FUTEX
     lock->owner = mprGetCurrentOsThread();
 #endif
     return (rc) ? 0 : 1;
@@ -122,7 +191,7 @@ PUBLIC MprSpin *mprCreateSpinLock()
     if ((lock = mprAllocObjNoZero(MprSpin, mprManageSpinLock)) == 0) {
         return 0;
     }
-    return mprInitSpinLock(lock);
+    return initSpinLock(lock, __builtin_return_address(0));
 }
 
 
@@ -130,7 +199,7 @@ PUBLIC void mprManageSpinLock(MprSpin *lock, int flags)
 {
     if (flags & MPR_MANAGE_FREE) {
         assert(lock);
-#if USE_MPR_LOCK || MACOSX
+#if USE_MPR_LOCK || MPR_FUTEX || MACOSX
         ;
 #elif BIT_UNIX_LIKE && BIT_HAS_SPINLOCK
         pthread_spin_destroy(&lock->cs);
@@ -151,11 +220,22 @@ PUBLIC void mprManageSpinLock(MprSpin *lock, int flags)
  */
 PUBLIC MprSpin *mprInitSpinLock(MprSpin *lock)
 {
-#if BIT_UNIX_LIKE && !BIT_HAS_SPINLOCK && !MACOSX
+    return initSpinLock(lock, __builtin_return_address(0));
+}
+
+
+static MprSpin *initSpinLock(MprSpin *lock, void *caller)
+{
+#if BIT_UNIX_LIKE && !BIT_HAS_SPINLOCK && !MACOSX && !MPR_FUTEX
     pthread_mutexattr_t attr;
 #endif
 
-#if USE_MPR_LOCK
+#if MPR_FUTEX
+    /*
+        Spin locks are adaptive mutexes that spin briefly and then sleep so a preempted holder does not burn a cpu
+     */
+    initMutex(&lock->cs, caller);
+#elif USE_MPR_LOCK
     mprInitLock(&lock->cs);
 #elif MACOSX
     lock->cs = OS_SPINLOCK_INIT;
@@ -198,8 +278,8 @@ PUBLIC bool mprTrySpinLock(MprSpin *lock)
 
     if (lock == 0) return 0;
 
-#if USE_MPR_LOCK
-    mprTryLock(&lock->cs);
+#if USE_MPR_LOCK || MPR_FUTEX
+    rc = !mprTryLock(&lock->cs);
 #elif MACOSX
     rc = !OSSpinLockTry(&lock->cs);
 #elif BIT_UNIX_LIKE && BIT_HAS_SPINLOCK
@@ -260,8 +340,24 @@ PUBLIC void mprGlobalUnlock()
  */
 PUBLIC void mprLock(MprMutex *lock)
 {
+#if MPR_FUTEX
+    MprOsThread     self;
+#endif
     if (lock == 0) return;
-#if BIT_UNIX_LIKE
+#if MPR_FUTEX
+    self = mprGetCurrentOsThread();
+    if (lock->owner == self) {
+        lock->depth++;
+        return;
+    }
+    if (!__sync_bool_compare_and_swap(&lock->state, 0, 1)) {
+        lockContended(lock);
+    } else if (lockProfile && lock->site) {
+        __sync_fetch_and_add(&lock->site->locks, 1);
+    }
+    lock->owner = self;
+    lock->depth = 1;
+#elif BIT_UNIX_LIKE
     pthread_mutex_lock(&lock->cs);
 #elif BIT_WIN_LIKE
     /* Rely on SpinCount being non-zero */
@@ -271,7 +367,7 @@ PUBLIC void mprLock(MprMutex *lock)
 #elif VXWORKS
     semTake(lock->cs, WAIT_FOREVER);
 #endif
-#if BIT_DEBUG
+#if BIT_DEBUG && !MPR_FUTEX
     /* Store last locker only */ 
     lock->owner = mprGetCurrentOsThread();
 #endif
@@ -281,7 +377,22 @@ PUBLIC void mprLock(MprMutex *lock)
 PUBLIC void mprUnlock(MprMutex *lock)
 {
     if (lock == 0) return;
-#if BIT_UNIX_LIKE
+#if MPR_FUTEX
+    if (lock->owner != mprGetCurrentOsThread()) {
+        /* Like a recursive pthread mutex, ignore unlocks by a thread that does not hold the lock */
+        assert(lock->owner == mprGetCurrentOsThread());
+        return;
+    }
+    if (--lock->depth > 0) {
+        return;
+    }
+    lock->owner = 0;
+    if (__sync_fetch_and_sub(&lock->state, 1) != 1) {
+        /* There may be sleepers */
+        lock->state = 0;
+        syscall(SYS_futex, &lock->state, FUTEX_WAKE_PRIVATE, 1, NULL, NULL, 0);
+    }
+#elif BIT_UNIX_LIKE
     pthread_mutex_unlock(&lock->cs);
 #elif BIT_WIN_LIKE
     LeaveCriticalSection(&lock->cs);
@@ -308,8 +419,8 @@ PUBLIC void mprSpinLock(MprSpin *lock)
     assert(lock->owner != mprGetCurrentOsThread());
 #endif
 
-#if USE_MPR_LOCK
-    mprTryLock(&lock->cs);
+#if USE_MPR_LOCK || MPR_FUTEX
+    mprLock(&lock->cs);
 #elif MACOSX
     OSSpinLockLock(&lock->cs);
 #elif BIT_UNIX_LIKE && BIT_HAS_SPINLOCK
@@ -338,7 +449,7 @@ PUBLIC void mprSpinUnlock(MprSpin *lock)
     lock->owner = 0;
 #endif
 
-#if USE_MPR_LOCK
+#if USE_MPR_LOCK || MPR_FUTEX
     mprUnlock(&lock->cs);
 #elif MACOSX
     OSSpinLockUnlock(&lock->cs);
@@ -354,6 +465,432 @@ PUBLIC void mprSpinUnlock(MprSpin *lock)
 }
 
 
+#if MPR_FUTEX
+/*
+    Futex based adaptive locks. The state is 0 when unlocked, 1 when locked and 2 when locked with possible sleepers.
+    An uncontended lock or unlock is a single atomic operation. A contended lock spins with exponential backoff 
+    while the holder is likely running on another cpu and then sleeps in the kernel. Locks are recursive.
+ */
+static void initMutex(MprMutex *lock, void *caller)
+{
+    lock->state = 0;
+    lock->depth = 0;
+    lock->owner = 0;
+    if ((lock->site = findSite(caller)) != 0) {
+        __sync_fetch_and_add(&lock->site->count, 1);
+    }
+}
+
+
+static void lockContended(MprMutex *lock)
+{
+    MprLockSite     *site;
+    uint64          start, elapsed;
+    int             i, j, delay, parked;
+
+    site = (lockProfile) ? lock->site : 0;
+    start = (site) ? mprGetMicroTicks() : 0;
+    parked = 0;
+
+    for (i = 0, delay = 1; i < getSpinLimit(); i++) {
+        if (lock->state == 0 && __sync_bool_compare_and_swap(&lock->state, 0, 1)) {
+            break;
+        }
+        for (j = 0; j < delay; j++) {
+            cpuRelax();
+        }
+        if (delay < MPR_LOCK_BACKOFF) {
+            delay <<= 1;
+        }
+    }
+    if (i >= getSpinLimit()) {
+        /*
+            Mark the lock as having sleepers so the holder will wake us on unlock
+         */
+        while (__sync_lock_test_and_set(&lock->state, 2) != 0) {
+            parked = 1;
+            syscall(SYS_futex, &lock->state, FUTEX_WAIT_PRIVATE, 2, NULL, NULL, 0);
+        }
+    }
+    if (site) {
+        elapsed = mprGetMicroTicks() - start;
+        __sync_fetch_and_add(&site->locks, 1);
+        __sync_fetch_and_add(&site->contended, 1);
+        __sync_fetch_and_add(&site->waitTime, elapsed);
+        if (parked) {
+            __sync_fetch_and_add(&site->parked, 1);
+        }
+        if (elapsed > site->maxWait) {
+            site->maxWait = elapsed;
+        }
+    }
+}
+
+
+static int getSpinLimit()
+{
+    if (lockSpin < 0) {
+        /* Spinning on a single cpu only delays the holder */
+        lockSpin = (sysconf(_SC_NPROCESSORS_ONLN) > 1) ? MPR_LOCK_SPIN : 0;
+    }
+    return lockSpin;
+}
+
+
+/*
+    Find or claim the profiling record for a lock creation site. This must not allocate as spin locks for the 
+    allocator are created before the heap exists.
+ */
+static MprLockSite *findSite(void *caller)
+{
+    MprLockSite     *site;
+    int             i, index;
+
+    index = (int) (((size_t) caller >> 2) % MPR_LOCK_SITES);
+    for (i = 0; i < MPR_LOCK_SITES; i++) {
+        site = &lockSites[(index + i) % MPR_LOCK_SITES];
+        if (site->caller == caller) {
+            return site;
+        }
+        if (site->caller == 0 && __sync_bool_compare_and_swap(&site->caller, 0, caller)) {
+            return site;
+        }
+        if (site->caller == caller) {
+            return site;
+        }
+    }
+    return 0;
+}
+
+
+static int compareSites(MprLockSite **s1, MprLockSite **s2)
+{
+    if ((*s1)->waitTime != (*s2)->waitTime) {
+        return ((*s1)->waitTime < (*s2)->waitTime) ? 1 : -1;
+    }
+    if ((*s1)->locks != (*s2)->locks) {
+        return ((*s1)->locks < (*s2)->locks) ? 1 : -1;
+    }
+    return 0;
+}
+#endif /* MPR_FUTEX */
+
+
+PUBLIC MprRWLock *mprCreateRWLock(int flags)
+{
+    MprRWLock   *lock;
+#if MPR_FUTEX
+    int         count;
+#endif
+
+    if ((lock = mprAllocObjNoZero(MprRWLock, manageRWLock)) == 0) {
+        return 0;
+    }
+    lock->owner = 0;
+    lock->depth = 0;
+#if MPR_FUTEX
+    lock->state = 0;
+    lock->seq = 0;
+    lock->sleepers = 0;
+    lock->nslots = 0;
+    lock->slots = 0;
+    if (flags & MPR_RWLOCK_PERCPU) {
+        for (count = 1; count < (int) MPR->heap->stats.numCpu && count < 64; count <<= 1) ;
+        if ((lock->slots = mprAllocZeroed(count * sizeof(MprRWSlot))) == 0) {
+            return 0;
+        }
+        lock->nslots = count;
+    }
+#elif BIT_UNIX_LIKE
+    pthread_rwlock_init(&lock->cs, NULL);
+#else
+    lock->mutex = mprCreateLock();
+#endif
+    return lock;
+}
+
+
+static void manageRWLock(MprRWLock *lock, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+#if MPR_FUTEX
+        mprMark(lock->slots);
+#elif !BIT_UNIX_LIKE
+        mprMark(lock->mutex);
+#endif
+    } else if (flags & MPR_MANAGE_FREE) {
+#if MPR_FUTEX
+        assert(lock->state == 0);
+#elif BIT_UNIX_LIKE
+        pthread_rwlock_destroy(&lock->cs);
+#endif
+    }
+}
+
+
+#if MPR_FUTEX
+/*
+    Select the per-cpu count for this thread. Threads rarely migrate, so a thread hash approximates the cpu and 
+    guarantees the unlock uses the same count as the lock.
+ */
+static BIT_INLINE MprRWSlot *getSlot(MprRWLock *lock, MprOsThread self)
+{
+    return &lock->slots[(int) (((uint64) self * 0x9E3779B97F4A7C15ULL) >> 58) & (lock->nslots - 1)];
+}
+#endif
+
+
+PUBLIC void mprReadLock(MprRWLock *lock)
+{
+#if MPR_FUTEX
+    MprRWSlot   *slot;
+    MprOsThread self;
+    int         spins, state;
+#endif
+
+    if (lock == 0) return;
+#if MPR_FUTEX
+    self = mprGetCurrentOsThread();
+    if (lock->owner == self) {
+        lock->depth++;
+        return;
+    }
+    spins = 0;
+    if (lock->slots) {
+        slot = getSlot(lock, self);
+        while (1) {
+            __sync_fetch_and_add(&slot->count, 1);
+            if ((lock->state & ~RW_READERS) == 0) {
+                return;
+            }
+            /* A writer is waiting or active. Back out and let it drain the per-cpu counts */
+            __sync_fetch_and_sub(&slot->count, 1);
+            __sync_fetch_and_add(&lock->seq, 1);
+            rwWake(lock, &lock->seq);
+            while ((state = lock->state) & ~RW_READERS) {
+                if (spins++ < getSpinLimit()) {
+                    cpuRelax();
+                } else {
+                    rwPark(lock, &lock->state, state);
+                }
+            }
+        }
+    }
+    while (1) {
+        state = lock->state;
+        if ((state & ~RW_READERS) == 0) {
+            if (__sync_bool_compare_and_swap(&lock->state, state, state + 1)) {
+                return;
+            }
+        } else if (spins++ < getSpinLimit()) {
+            cpuRelax();
+        } else {
+            rwPark(lock, &lock->state, state);
+        }
+    }
+#elif BIT_UNIX_LIKE
+    if (lock->owner == mprGetCurrentOsThread()) {
+        lock->depth++;
+        return;
+    }
+    pthread_rwlock_rdlock(&lock->cs);
+#else
+    mprLock(lock->mutex);
+#endif
+}
+
+
+PUBLIC void mprReadUnlock(MprRWLock *lock)
+{
+#if MPR_FUTEX
+    int         state;
+#endif
+
+    if (lock == 0) return;
+#if MPR_FUTEX || BIT_UNIX_LIKE
+    if (lock->owner == mprGetCurrentOsThread()) {
+        lock->depth--;
+        return;
+    }
+#endif
+#if MPR_FUTEX
+    if (lock->slots) {
+        __sync_fetch_and_sub(&getSlot(lock, mprGetCurrentOsThread())->count, 1);
+        if (lock->state & ~RW_READERS) {
+            __sync_fetch_and_add(&lock->seq, 1);
+            rwWake(lock, &lock->seq);
+        }
+    } else {
+        state = __sync_sub_and_fetch(&lock->state, 1);
+        if ((state & RW_READERS) == 0 && state) {
+            rwWake(lock, &lock->state);
+        }
+    }
+#elif BIT_UNIX_LIKE
+    pthread_rwlock_unlock(&lock->cs);
+#else
+    mprUnlock(lock->mutex);
+#endif
+}
+
+
+PUBLIC void mprWriteLock(MprRWLock *lock)
+{
+    MprOsThread self;
+#if MPR_FUTEX
+    int         i, seq, spins, state, count;
+#endif
+
+    if (lock == 0) return;
+    self = mprGetCurrentOsThread();
+    if (lock->owner == self) {
+        lock->depth++;
+        return;
+    }
+#if MPR_FUTEX
+    /*
+        Announce the writer so new readers block, then wait for active readers and writers to finish
+     */
+    __sync_fetch_and_add(&lock->state, RW_WAITING);
+    for (spins = 0; ; ) {
+        state = lock->state;
+        if ((state & (RW_WRITER | RW_READERS)) == 0) {
+            if (__sync_bool_compare_and_swap(&lock->state, state, state - RW_WAITING + RW_WRITER)) {
+                break;
+            }
+        } else if (spins++ < getSpinLimit()) {
+            cpuRelax();
+        } else {
+            rwPark(lock, &lock->state, state);
+        }
+    }
+    if (lock->slots) {
+        for (spins = 0; ; ) {
+            seq = lock->seq;
+            __sync_synchronize();
+            for (count = i = 0; i < lock->nslots; i++) {
+                count += lock->slots[i].count;
+            }
+            if (count == 0) {
+                break;
+            }
+            if (spins++ < getSpinLimit()) {
+                cpuRelax();
+            } else {
+                rwPark(lock, &lock->seq, seq);
+            }
+        }
+    }
+#elif BIT_UNIX_LIKE
+    pthread_rwlock_wrlock(&lock->cs);
+#else
+    mprLock(lock->mutex);
+#endif
+    lock->owner = self;
+    lock->depth = 1;
+}
+
+
+PUBLIC void mprWriteUnlock(MprRWLock *lock)
+{
+    if (lock == 0) return;
+    if (lock->owner != mprGetCurrentOsThread()) {
+        assert(lock->owner == mprGetCurrentOsThread());
+        return;
+    }
+    if (--lock->depth > 0) {
+        return;
+    }
+    lock->owner = 0;
+#if MPR_FUTEX
+    __sync_fetch_and_sub(&lock->state, RW_WRITER);
+    rwWake(lock, &lock->state);
+#elif BIT_UNIX_LIKE
+    pthread_rwlock_unlock(&lock->cs);
+#else
+    mprUnlock(lock->mutex);
+#endif
+}
+
+
+#if MPR_FUTEX
+/*
+    Sleep while *addr == value. The sleepers count lets unlock skip the wake system call when nobody sleeps.
+ */
+static void rwPark(MprRWLock *lock, volatile int *addr, int value)
+{
+    __sync_fetch_and_add(&lock->sleepers, 1);
+    syscall(SYS_futex, addr, FUTEX_WAIT_PRIVATE, value, NULL, NULL, 0);
+    __sync_fetch_and_sub(&lock->sleepers, 1);
+}
+
+
+static void rwWake(MprRWLock *lock, volatile int *addr)
+{
+    if (lock->sleepers) {
+        syscall(SYS_futex, addr, FUTEX_WAKE_PRIVATE, MAXINT, NULL, NULL, 0);
+    }
+}
+#endif
+
+
+PUBLIC bool mprSetLockProfile(bool enable)
+{
+#if MPR_FUTEX
+    MprLockSite     *site;
+    bool            prior;
+
+    prior = lockProfile;
+    if (enable && !prior) {
+        for (site = lockSites; site < &lockSites[MPR_LOCK_SITES]; site++) {
+            site->locks = site->contended = site->parked = site->waitTime = site->maxWait = 0;
+        }
+    }
+    lockProfile = enable;
+    return prior;
+#else
+    return 0;
+#endif
+}
+
+
+PUBLIC void mprPrintLockStats()
+{
+#if MPR_FUTEX
+    MprLockSite     *site, *sites[MPR_LOCK_SITES];
+    Dl_info         info;
+    char            name[64];
+    int             i, count;
+
+    if (!lockProfile) {
+        return;
+    }
+    for (count = 0, site = lockSites; site < &lockSites[MPR_LOCK_SITES]; site++) {
+        if (site->caller && site->locks) {
+            sites[count++] = site;
+        }
+    }
+    qsort(sites, count, sizeof(MprLockSite*), (int (*)(cvoid*, cvoid*)) compareSites);
+
+    printf("\nLock Contention:\n");
+    printf("  %-36s %5s %12s %10s %10s %12s %10s\n", "Site", "Locks", "Acquired", "Contended", "Parked",
+        "Wait usec", "Max usec");
+    for (i = 0; i < count; i++) {
+        site = sites[i];
+        if (dladdr(site->caller, &info) && info.dli_sname) {
+            snprintf(name, sizeof(name), "%s+0x%x", info.dli_sname, 
+                (int) ((char*) site->caller - (char*) info.dli_saddr));
+        } else {
+            snprintf(name, sizeof(name), "%p", site->caller);
+        }
+        printf("  %-36s %5d %12lld %10lld %10lld %12lld %10lld\n", name, site->count, site->locks, site->contended, 
+            site->parked, site->waitTime, site->maxWait);
+    }
+    printf("\n");
+#endif
+}
+
+
 /*
     @copy   default
 
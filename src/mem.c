@@ -132,6 +132,9 @@ static BIT_INLINE int cas(size_t *target, size_t expected, size_t value);
 static BIT_INLINE bool claim(MprMem *mp);
 static BIT_INLINE void clearbitmap(size_t *bitmap, int bindex);
 static void dummyManager(void *ptr, int flags);
+#if LINUX
+static void bindToNode(void *ptr, size_t size);
+#endif
 static size_t fastMemSize();
 static void freeBlock(MprMem *mp);
 static void getSystemInfo();
@@ -799,6 +802,11 @@ static void *vmalloc(size_t size, int mode)
         if ((ptr = mmap(0, size, mode, MAP_PRIVATE | MAP_ANON, -1, 0)) == (void*) -1) {
             return 0;
         }
+        #if LINUX
+            if (heap && heap->numa) {
+                bindToNode(ptr, size);
+            }
+        #endif
     #elif BIT_WIN_LIKE
         ptr = VirtualAlloc(0, size, MEM_RESERVE | MEM_COMMIT, winPageModes(mode));
     #else
@@ -815,6 +823,29 @@ static void *vmalloc(size_t size, int mode)
 }
 
 
+#if LINUX
+#ifndef MPOL_PREFERRED
+    #define MPOL_PREFERRED 1
+#endif
+/*
+    Prefer the NUMA node of the CPU running this thread for the pages of a new region. Errors are ignored as the 
+    kernel may not support NUMA.
+ */
+static void bindToNode(void *ptr, size_t size)
+{
+    ulong   mask[4];
+    uint    cpu, node;
+
+    if (syscall(SYS_getcpu, &cpu, &node, NULL) < 0 || node >= sizeof(mask) * 8) {
+        return;
+    }
+    memset(mask, 0, sizeof(mask));
+    mask[node / (sizeof(ulong) * 8)] |= 1UL << (node % (sizeof(ulong) * 8));
+    syscall(SYS_mbind, ptr, size, MPOL_PREFERRED, mask, sizeof(mask) * 8, 0);
+}
+#endif
+
+
 static void vmfree(void *ptr, size_t size)
 {
 #if BIT_MPR_ALLOC_VIRTUAL
@@ -1633,6 +1664,7 @@ static void printMemReport()
 #endif
     }
 #endif /* BIT_MPR_ALLOC_STATS */
+    mprPrintLockStats();
 }
 
 
@@ -2051,7 +2083,9 @@ static BIT_INLINE int findLastBit(size_t word)
  */
 static BIT_INLINE bool acquire(MprFreeQueue *freeq)
 {
-#if MACOSX
+#if MPR_FUTEX
+    return mprTrySpinLock(&freeq->lock);
+#elif MACOSX
     return OSSpinLockTry(&freeq->lock.cs);
 #elif BIT_UNIX_LIKE && BIT_HAS_SPINLOCK
     return pthread_spin_trylock(&freeq->lock.cs) == 0;
@@ -2069,7 +2103,9 @@ static BIT_INLINE bool acquire(MprFreeQueue *freeq)
 
 static BIT_INLINE void release(MprFreeQueue *freeq)
 {
-#if MACOSX
+#if MPR_FUTEX
+    mprSpinUnlock(&freeq->lock);
+#elif MACOSX
     OSSpinLockUnlock(&freeq->lock.cs);
 #elif BIT_UNIX_LIKE && BIT_HAS_SPINLOCK
     pthread_spin_unlock(&freeq->lock.cs);
@@ -2177,6 +2213,12 @@ PUBLIC void mprSetMemPolicy(int policy)
 }
 
 
+PUBLIC void mprSetMemNuma(bool enable)
+{
+    heap->numa = enable;
+}
+
+
 PUBLIC void mprSetMemError()
 {
     heap->hasError = 1;
@@ -86,7 +86,7 @@ PUBLIC MprHash *mprCreateMimeTypes(cchar *path)
         if ((file = mprOpenFile(path, O_RDONLY | O_TEXT, 0)) == 0) {
             return 0;
         }
-        if ((table = mprCreateHash(47, 0)) == 0) {
+        if ((table = mprCreateHash(47, MPR_HASH_READ_MOSTLY)) == 0) {
             mprCloseFile(file);
             return 0;
         }
@@ -112,7 +112,7 @@ PUBLIC MprHash *mprCreateMimeTypes(cchar *path)
     } else 
 #endif
     {
-        if ((table = mprCreateHash(59, 0)) == 0) {
+        if ((table = mprCreateHash(59, MPR_HASH_READ_MOSTLY)) == 0) {
             return 0;
         }
         addStandardMimeTypes(table);
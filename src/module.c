@@ -25,7 +25,7 @@ PUBLIC MprModuleService *mprCreateModuleService()
         return 0;
     }
     ms->modules = mprCreateList(-1, 0);
-    ms->mutex = mprCreateLock();
+    ms->rwlock = mprCreateRWLock(MPR_RWLOCK_PERCPU);
     MPR->moduleService = ms;
     mprSetModuleSearchPath(NULL);
     return ms;
@@ -37,7 +37,7 @@ static void manageModuleService(MprModuleService *ms, int flags)
     if (flags & MPR_MANAGE_MARK) {
         mprMark(ms->modules);
         mprMark(ms->searchPath);
-        mprMark(ms->mutex);
+        mprMark(ms->rwlock);
     }
 }
 
@@ -74,11 +74,11 @@ PUBLIC void mprStopModuleService()
 
     ms = MPR->moduleService;
     assert(ms);
-    mprLock(ms->mutex);
+    mprWriteLock(ms->rwlock);
     for (next = 0; (mp = mprGetNextItem(ms->modules, &next)) != 0; ) {
         mprStopModule(mp);
     }
-    mprUnlock(ms->mutex);
+    mprWriteUnlock(ms->rwlock);
 }
 
 
@@ -101,7 +101,9 @@ PUBLIC MprModule *mprCreateModule(cchar *name, cchar *path, cchar *entry, void *
     }
     mp->moduleData = data;
     mp->lastActivity = mprGetTicks();
+    mprWriteLock(ms->rwlock);
     index = mprAddItem(ms->modules, mp);
+    mprWriteUnlock(ms->rwlock);
     if (index < 0 || mp->name == 0) {
         return 0;
     }
@@ -162,13 +164,15 @@ PUBLIC MprModule *mprLookupModule(cchar *name)
     ms = MPR->moduleService;
     assert(ms);
 
+    mprReadLock(ms->rwlock);
     for (next = 0; (mp = mprGetNextItem(ms->modules, &next)) != 0; ) {
         assert(mp->name);
         if (mp && strcmp(mp->name, name) == 0) {
-            return mp;
+            break;
         }
     }
-    return 0;
+    mprReadUnlock(ms->rwlock);
+    return mp;
 }
 
 
@@ -255,7 +259,9 @@ PUBLIC int mprUnloadModule(MprModule *mp)
         mp->handle = 0;
     }
 #endif
+    mprWriteLock(MPR->moduleService->rwlock);
     mprRemoveItem(MPR->moduleService->modules, mp);
+    mprWriteUnlock(MPR->moduleService->rwlock);
     return 0;
 }
 
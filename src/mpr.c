@@ -97,6 +97,7 @@ PUBLIC Mpr *mprCreate(int argc, char **argv, int flags)
     mpr->workerService = mprCreateWorkerService();
     mpr->waitService = mprCreateWaitService();
     mpr->socketService = mprCreateSocketService();
+    mprStartSignalService();
 
     mpr->dispatcher = mprCreateDispatcher("main", 0);
     mpr->nonBlock = mprCreateDispatcher("nonblock", 0);
@@ -51,6 +51,7 @@ struct  MprFile;
 struct  MprFileSystem;
 struct  MprHash;
 struct  MprHeap;
+struct  MprIORequest;
 struct  MprList;
 struct  MprKey;
 struct  MprModule;
@@ -63,6 +64,7 @@ struct  MprSocketService;
 struct  MprSsl;
 struct  MprThread;
 struct  MprThreadService;
+struct  MprUring;
 struct  MprWaitService;
 struct  MprWaitHandler;
 struct  MprWorker;
@@ -135,6 +137,7 @@ struct  MprXml;
 
 #define MPR_TIMEOUT_PRUNER      120000      /**< Time between worker thread pruner runs (2 min) */
 #define MPR_TIMEOUT_WORKER      60000       /**< Prune worker that has been idle for 1 min */
+#define MPR_TIMEOUT_WORKER_TUNE 5000        /**< Prune excess worker idle for 5 sec when adaptively sizing the pool */
 #define MPR_TIMEOUT_START_TASK  10000       /**< Time to start tasks running */
 #define MPR_TIMEOUT_STOP        30000       /**< Default wait when stopping resources (30 sec) */
 #define MPR_TIMEOUT_STOP_TASK   10000       /**< Time to stop or reap tasks (vxworks) */
@@ -142,6 +145,8 @@ struct  MprXml;
 #define MPR_TIMEOUT_GC_SYNC     100         /**< Short wait period for threads to synchronize */
 #define MPR_TIMEOUT_NO_BUSY     1000        /**< Wait period to minimize CPU drain */
 #define MPR_TIMEOUT_NAP         20          /**< Short pause */
+#define MPR_TIMEOUT_DNS         60000       /**< Lifespan of a cached host address (1 min) */
+#define MPR_TIMEOUT_DNS_FAIL    0           /**< Lifespan of a cached host resolution failure (not cached) */
 
 #define MPR_TICKS_PER_SEC       1000        /**< Time ticks per second */
 #define MPR_MAX_TIMEOUT         MAXINT
@@ -166,6 +171,7 @@ struct  MprXml;
 /*
     Other tunable constants
  */
+#define MPR_DNS_CACHE_MAX       1024        /**< Max cached host addresses before pruning */
 #define MPR_TEST_POLL_NAP       25
 #define MPR_TEST_SLEEP          (60 * 1000)
 #define MPR_TEST_MAX_STACK      16
@@ -187,10 +193,19 @@ struct  MprXml;
 /*
     Event notification mechanism
  */
+#ifndef BIT_MPR_IO_URING
+    #define BIT_MPR_IO_URING    0           /**< Use io_uring on Linux if the kernel supports it */
+#endif
 #if MACOSX || SOLARIS
     #define MPR_EVENT_KQUEUE    1
 #elif LINUX || BIT_BSD_LIKE
     #define MPR_EVENT_EPOLL     1
+    #if LINUX && BIT_MPR_IO_URING
+        /*
+            The io_uring notifier is layered over epoll which is used as the fallback if the kernel lacks support
+         */
+        #define MPR_EVENT_IO_URING 1
+    #endif
 #elif WINDOWS
     #define MPR_EVENT_ASYNC     1
 #else
@@ -385,15 +400,25 @@ PUBLIC void assert(bool cond);
 /*********************************** Thread Sync ******************************/
 /**
     Multithreaded Synchronization Services
-    @see MprCond MprMutex MprSpin mprAtomicAdd mprAtomicAdd64 mprAtomicBarrier mprAtomicCas mprAtomicExchange 
-        mprAtomicListInsert mprCreateCond mprCreateLock mprCreateSpinLock mprGlobalLock mprGlobalUnlock mprInitLock 
-        mprInitSpinLock mprLock mprResetCond mprSignalCond mprSignalMultiCond mprSpinLock mprSpinUnlock mprTryLock 
-        mprTrySpinLock mprUnlock mprWaitForCond mprWaitForMultiCond 
+    @see MprCond MprMutex MprRWLock MprSpin mprAtomicAdd mprAtomicAdd64 mprAtomicBarrier mprAtomicCas mprAtomicExchange 
+        mprAtomicListInsert mprCreateCond mprCreateLock mprCreateRWLock mprCreateSpinLock mprGlobalLock mprGlobalUnlock mprInitLock 
+        mprInitSpinLock mprLock mprPrintLockStats mprResetCond mprSetLockProfile mprSignalCond mprSignalMultiCond 
+        mprReadLock mprReadUnlock mprSpinLock mprSpinUnlock mprTryLock mprTrySpinLock mprUnlock mprWaitForCond 
+        mprWaitForMultiCond mprWriteLock mprWriteUnlock 
     @stability Internal.
     @defgroup MprSynch MprSynch
  */
 typedef struct MprSynch { int dummy; } MprSynch;
 
+#ifndef BIT_MPR_FUTEX
+    #define BIT_MPR_FUTEX       1           /**< Implement locks and condition variables using futexes on Linux */
+#endif
+#if LINUX && BIT_MPR_FUTEX && defined(SYS_futex) && defined(__GNUC__)
+    #define MPR_FUTEX      1
+#else
+    #define MPR_FUTEX      0
+#endif
+
 /**
     Condition variable for single and multi-thread synchronization. Condition variables can be used to coordinate 
     activities. These variables are level triggered in that a condition can be signalled prior to another thread 
@@ -403,7 +428,10 @@ typedef struct MprSynch { int dummy; } MprSynch;
     @stability Internal.
  */
 typedef struct MprCond {
-    #if BIT_UNIX_LIKE
+    #if MPR_FUTEX
+        volatile int seq;           /**< Futex word for waking multiple waiters */
+        volatile int waiters;       /**< Number of threads blocked on a futex */
+    #elif BIT_UNIX_LIKE
         pthread_cond_t cv;          /**< Unix pthreads condition variable */
     #elif BIT_WIN_LIKE
         HANDLE cv;                  /**< Windows event handle */
@@ -412,8 +440,8 @@ typedef struct MprCond {
     #else
         #warning "Unsupported OS in MprCond definition in mpr.h"
     #endif
-    struct MprMutex *mutex;         /**< Thread synchronization mutex */
-    volatile int triggered;         /**< Value of the condition */
+    struct MprMutex *mutex;         /**< Thread synchronization mutex (not used with futexes) */
+    volatile int triggered;         /**< Value of the condition. Futex word for single waiters */
 } MprCond;
 
 
@@ -488,7 +516,11 @@ PUBLIC int mprWaitForMultiCond(MprCond *cond, MprTicks timeout);
     @stability Internal.
  */
 typedef struct MprMutex {
-    #if BIT_WIN_LIKE
+    #if MPR_FUTEX
+        volatile int state;             /**< Futex word: 0 unlocked, 1 locked, 2 locked with waiters */
+        int         depth;              /**< Recursive lock depth of the owner */
+        struct MprLockSite *site;       /**< Creation site record for contention profiling */
+    #elif BIT_WIN_LIKE
         CRITICAL_SECTION cs;            /**< Internal mutex critical section */
     #elif VXWORKS
         SEM_ID      cs;
@@ -497,9 +529,31 @@ typedef struct MprMutex {
     #else
         #warning "Unsupported OS in MprMutex definition in mpr.h"
     #endif
-        MprOsThread owner;
+        MprOsThread owner;              /**< Owning thread (futex locks) or last locker (debug) */
 } MprMutex;
 
+/**
+    Lock contention statistics
+    @description Locks record acquisitions against the code address that created them. When profiling is enabled
+        via #mprSetLockProfile, each site accumulates the number of acquisitions, how many found the lock held,
+        how many had to sleep in the kernel and the time spent waiting.
+    @ingroup MprSynch
+    @stability Prototype
+ */
+typedef struct MprLockSite {
+    void        *caller;                /**< Code address that created the lock */
+    uint64      locks;                  /**< Number of acquisitions */
+    uint64      contended;              /**< Acquisitions that found the lock held */
+    uint64      parked;                 /**< Acquisitions that slept after spinning */
+    uint64      waitTime;               /**< Total time waiting for the lock in microseconds */
+    uint64      maxWait;                /**< Longest wait for the lock in microseconds */
+    int         count;                  /**< Number of locks created at this site */
+} MprLockSite;
+
+#define MPR_LOCK_SITES      509         /**< Number of distinct lock creation sites profiled */
+#define MPR_LOCK_SPIN       100         /**< Contended lock attempts before sleeping (multi-cpu only) */
+#define MPR_LOCK_BACKOFF    64          /**< Maximum cpu relax cycles between spin attempts */
+
 
 /**
     Multithreading spin lock control structure
@@ -508,7 +562,7 @@ typedef struct MprMutex {
     @stability Internal.
  */
 typedef struct MprSpin {
-    #if USE_MPR_LOCK
+    #if USE_MPR_LOCK || MPR_FUTEX
         MprMutex                cs;
     #elif BIT_WIN_LIKE
         CRITICAL_SECTION        cs;            /**< Internal mutex critical section */
@@ -610,7 +664,7 @@ PUBLIC void mprManageSpinLock(MprSpin *lock, int flags);
 /*
     For maximum performance, use the spin lock/unlock routines macros
  */
-#if !BIT_DEBUG
+#if !BIT_DEBUG && !MPR_FUTEX
 #define BIT_USE_LOCK_MACROS 1
 #endif
 #if BIT_USE_LOCK_MACROS && !DOXYGEN
@@ -701,6 +755,99 @@ PUBLIC void mprGlobalLock();
  */
 PUBLIC void mprGlobalUnlock();
 
+/**
+    Print lock contention statistics
+    @description Prints to stdout the lock profiling statistics for each lock creation site, sorted by the total
+        time spent waiting. Sites are printed as a symbol and offset where the symbol can be resolved. This is
+        also printed by #mprPrintMem when lock profiling is enabled.
+    @ingroup MprSynch
+    @stability Prototype
+ */
+PUBLIC void mprPrintLockStats();
+
+/**
+    Enable or disable lock contention profiling
+    @description When enabled, each lock acquisition is counted against the code address that created the lock
+        and contended acquisitions record the time spent waiting. Enabling profiling resets prior statistics.
+        Profiling is only supported on systems using futex based locks.
+    @param enable Set to true to enable profiling.
+    @return True if profiling was previously enabled.
+    @ingroup MprSynch
+    @stability Prototype
+ */
+PUBLIC bool mprSetLockProfile(bool enable);
+
+/**
+    Reader-writer lock control structure
+    @description MprRWLock permits many concurrent readers or one writer. It is writer preferring: once a writer is 
+        waiting, new readers block until the writer has finished. The writer may recursively take the write lock 
+        and may take read locks while holding the write lock. Readers must not recursively take read locks.
+        Created with MPR_RWLOCK_PERCPU, readers increment one of several cache line separated counts selected by
+        thread so that readers on different CPUs do not contend. This makes writers slower.
+    @ingroup MprSynch
+    @stability Prototype
+ */
+typedef struct MprRWLock {
+    #if MPR_FUTEX
+        volatile int    state;          /**< Futex word: reader count, waiting writers and writer flag */
+        volatile int    seq;            /**< Futex word for a writer waiting for per-cpu readers to drain */
+        volatile int    sleepers;       /**< Number of threads sleeping on the futex words */
+        int             nslots;         /**< Number of per-cpu reader counts */
+        struct MprRWSlot *slots;        /**< Per-cpu reader counts */
+    #elif BIT_UNIX_LIKE
+        pthread_rwlock_t cs;
+    #else
+        MprMutex        *mutex;         /**< Exclusive lock for readers and writers */
+    #endif
+    MprOsThread         owner;          /**< Thread holding the write lock */
+    int                 depth;          /**< Recursive write lock depth */
+} MprRWLock;
+
+#define MPR_RWLOCK_PERCPU   0x1         /**< Use per-cpu reader counts for read-mostly data */
+
+/**
+    Create a reader-writer lock
+    @param flags Set to MPR_RWLOCK_PERCPU to spread reader counts across CPUs.
+    @return A reader-writer lock object
+    @ingroup MprSynch
+    @stability Prototype
+ */
+PUBLIC MprRWLock *mprCreateRWLock(int flags);
+
+/**
+    Lock for reading
+    @description Blocks while a writer holds or is waiting for the lock.
+    @param lock Reader-writer lock created via #mprCreateRWLock. Ignored if null.
+    @ingroup MprSynch
+    @stability Prototype
+ */
+PUBLIC void mprReadLock(MprRWLock *lock);
+
+/**
+    Unlock a read lock
+    @param lock Reader-writer lock locked via #mprReadLock
+    @ingroup MprSynch
+    @stability Prototype
+ */
+PUBLIC void mprReadUnlock(MprRWLock *lock);
+
+/**
+    Lock for writing
+    @description Blocks until all readers and any other writer have released the lock.
+    @param lock Reader-writer lock created via #mprCreateRWLock. Ignored if null.
+    @ingroup MprSynch
+    @stability Prototype
+ */
+PUBLIC void mprWriteLock(MprRWLock *lock);
+
+/**
+    Unlock a write lock
+    @param lock Reader-writer lock locked via #mprWriteLock
+    @ingroup MprSynch
+    @stability Prototype
+ */
+PUBLIC void mprWriteUnlock(MprRWLock *lock);
+
 /*
     Lock free primitives
  */
@@ -1186,6 +1333,7 @@ typedef struct MprHeap {
     int              verify;                /**< Verify memory contents (very slow) */
     int              workDone;              /**< Count of allocations weighted by block size */
     int              workQuota;             /**< Quota of work done before idle GC worthwhile */
+    int              numa;                  /**< Bind new memory regions to the NUMA node of the allocating thread */
 } MprHeap;
 
 /**
@@ -1403,6 +1551,16 @@ PUBLIC void mprSetMemLimits(ssize warnHeap, ssize maximum, ssize cache);
 */
 PUBLIC void mprSetMemPolicy(int policy);
 
+/**
+    Bind memory regions to NUMA nodes
+    @description When enabled, new memory regions are bound to the NUMA node of the CPU running the allocating thread.
+        The binding is a preference so allocations do not fail if the node is exhausted. Only supported on Linux.
+    @param enable Set to true to enable node binding
+    @ingroup MprMem
+    @stability Prototype
+*/
+PUBLIC void mprSetMemNuma(bool enable);
+
 /**
     Update the manager for a block of memory.
     @description This call updates the manager for a block of memory allocated via mprAllocWithManager.
@@ -3096,6 +3254,17 @@ PUBLIC char *mprFormatTm(cchar *fmt, struct tm *timep);
  */
 PUBLIC MprTicks mprGetTicks();
 
+/**
+    Get the system time in microseconds.
+    @description Get a monotonically increasing time counter in microseconds. This is used for measuring short
+        intervals and does not represent wall-clock time. On systems without a fine grained clock, this has
+        millisecond resolution.
+    @return Returns the system time in microseconds.
+    @ingroup MprTime
+    @stability Prototype
+ */
+PUBLIC uint64 mprGetMicroTicks();
+
 /**
     Get the time.
     @description Get the date/time in milliseconds since Jan 1 1970.
@@ -4009,6 +4178,7 @@ typedef uint (*MprHashProc)(cvoid *name, ssize len);
 #define MPR_HASH_LIST           0x100   /**< Hash keys are numeric indicies */
 #define MPR_HASH_UNIQUE         0x200   /**< Add to existing will fail */
 #define MPR_HASH_OWN            0x400   /**< For own use. Not thread safe */
+#define MPR_HASH_READ_MOSTLY    0x800   /**< Lookups dominate. Use a per-cpu reader-writer lock */
 #define MPR_HASH_STATIC_ALL     (MPR_HASH_STATIC_KEYS | MPR_HASH_STATIC_VALUES)
 
 /**
@@ -4022,7 +4192,7 @@ typedef struct MprHash {
     int             length;             /**< Number of symbols in the table */
     MprKey          **buckets;          /**< Hash collision bucket table */
     MprHashProc     fn;                 /**< Hash function */
-    MprMutex        *mutex;             /**< GC marker sync */
+    MprRWLock       *rwlock;            /**< Lookup, update and GC marker sync */
 } MprHash;
 
 /*
@@ -4102,6 +4272,7 @@ PUBLIC MprHash *mprCloneHash(MprHash *table);
         if the hash keys are unicode strings, MPR_HASH_STATIC_KEYS if the keys are permanent and should not be
         managed for Garbage collection, and MPR_HASH_STATIC_VALUES if the values are permanent.
         MPR_HASH_OWN to create an optimized list for private use that is not thread-safe.
+        MPR_HASH_READ_MOSTLY for tables that are rarely updated so concurrent lookups scale across CPUs.
     @return Returns a pointer to the allocated symbol table.
     @ingroup MprHash
     @stability Stable.
@@ -5313,7 +5484,7 @@ PUBLIC void mprStopOsService();
 typedef struct MprModuleService {
     MprList         *modules;               /**< List of defined modules */
     char            *searchPath;            /**< Module search path to locate modules */
-    struct MprMutex *mutex;
+    struct MprRWLock *rwlock;               /**< Module list lookup and update sync */
 } MprModuleService;
 
 
@@ -5551,6 +5722,8 @@ PUBLIC int mprUnloadModule(MprModule *mp);
 #define MPR_EVENT_DONT_QUEUE        0x4     /**< Don't queue the event. User must call mprQueueEvent */
 #define MPR_EVENT_STATIC_DATA       0x8     /**< Event data is permanent and should not be marked by GC */
 #define MPR_EVENT_RUNNING           0x10    /**< Event currently executing */
+#define MPR_EVENT_NO_CANCEL         0x20    /**< Event is not cancelled when the dispatcher deadline expires */
+#define MPR_EVENT_ABORTED           0x40    /**< Event reports an operation that could not complete normally */
 #define MPR_EVENT_MAGIC             0x12348765
 
 /**
@@ -5597,6 +5770,50 @@ typedef struct MprEvent {
 #define MPR_DISPATCHER_WAITING      0x2 /**< Dispatcher waiting for an event in mprWaitForEvent */
 #define MPR_DISPATCHER_DESTROYED    0x4 /**< Dispatcher has been destroyed */
 #define MPR_DISPATCHER_AUTO         0x8 /**< Dispatcher was auto created in response to accept event */
+#define MPR_DISPATCHER_STICKY       0x10 /**< Dispatcher prefers its last worker and runs follow-up events in a batch */
+#define MPR_DISPATCHER_LINGER       0x20 /**< Dispatcher worker waiting for follow-up events */
+#define MPR_DISPATCHER_HIGH         0x40 /**< Create the dispatcher in the high priority class */
+#define MPR_DISPATCHER_LOW          0x80 /**< Create the dispatcher in the low (background) priority class */
+
+/*
+    Dispatcher priority classes. Lower values are higher priority.
+ */
+#define MPR_DISPATCHER_CLASS_HIGH   0   /**< Latency critical dispatchers */
+#define MPR_DISPATCHER_CLASS_NORMAL 1   /**< Default priority class */
+#define MPR_DISPATCHER_CLASS_LOW    2   /**< Background work such as pruning and bulk transfers */
+#define MPR_DISPATCHER_CLASSES      3   /**< Number of priority classes */
+
+#define MPR_DISPATCHER_BATCH        64  /**< Default maximum events to run per batch for sticky dispatchers */
+
+#define MPR_EVENT_HIST              24  /**< Number of log2 histogram buckets in event statistics */
+#define MPR_EVENT_SLOWEST           8   /**< Number of slowest event callbacks to track */
+
+/**
+    Event statistics for a dispatcher
+    @description Histograms use log2 buckets. Bucket zero counts zero values and bucket N counts values 
+        from 2^(N-1) to 2^N - 1. The last bucket also counts all larger values.
+    @ingroup MprDispatcher
+    @stability Prototype
+ */
+typedef struct MprEventStats {
+    uint64          count;                      /**< Number of events run */
+    uint64          delay[MPR_EVENT_HIST];      /**< Histogram of scheduling delay (when run - when due) in msec */
+    uint64          runtime[MPR_EVENT_HIST];    /**< Histogram of callback runtime in usec */
+    MprTicks        maxDelay;                   /**< Maximum scheduling delay in msec */
+    uint64          maxRuntime;                 /**< Maximum callback runtime in usec */
+} MprEventStats;
+
+/**
+    Record of a slow event callback
+    @ingroup MprDispatcher
+    @stability Prototype
+ */
+typedef struct MprSlowEvent {
+    char            name[32];                   /**< Event name */
+    char            dispatcher[32];             /**< Dispatcher name */
+    uint64          runtime;                    /**< Callback runtime in usec */
+    MprTicks        when;                       /**< When the callback completed */
+} MprSlowEvent;
 
 /**
     Event Dispatcher
@@ -5614,6 +5831,10 @@ typedef struct MprDispatcher {
     struct MprDispatcher *parent;       /**< Queue pointer */
     struct MprEventService *service;    /**< Event service reference */
     MprOsThread     owner;              /**< Owning thread of the dispatcher */
+    struct MprWorker *worker;           /**< Last worker to run the dispatcher (sticky dispatchers only) */
+    int             priority;           /**< Priority class (MPR_DISPATCHER_CLASS_*) */
+    MprEventStats   *stats;             /**< Event statistics if enabled via mprSetEventStats */
+    struct MprDeadline *deadline;       /**< Optional deadline governing dispatcher operations */
 } MprDispatcher;
 
 
@@ -5626,7 +5847,7 @@ typedef struct MprEventService {
     MprTicks        now;                /**< Current notion of system time for the dispatcher service */
     MprTicks        willAwake;          /**< When the event service will next awake */
     MprDispatcher   *runQ;              /**< Queue of running dispatchers */
-    MprDispatcher   *readyQ;            /**< Queue of dispatchers with events ready to run */
+    MprDispatcher   *readyQ[MPR_DISPATCHER_CLASSES]; /**< Per-class queues of dispatchers with events ready to run */
     MprDispatcher   *waitQ;             /**< Queue of waiting (future) events */
     MprDispatcher   *idleQ;             /**< Queue of idle dispatchers */
     MprDispatcher   *pendingQ;          /**< Queue of pending dispatchers (waiting for resources) */
@@ -5634,6 +5855,19 @@ typedef struct MprEventService {
     MprTicks        delay;              /**< Maximum sleep time before awaking */
     int             eventCount;         /**< Count of events */
     int             waiting;            /**< Waiting for I/O (sleeping) */
+    int             spinning;           /**< Busy-polling for I/O (not sleeping) */
+    int             spinBudget;         /**< Microseconds to busy-poll after activity before sleeping */
+    int             batchCount;         /**< Maximum events to run per batch on a sticky dispatcher worker */
+    MprTicks        batchTime;          /**< Time a sticky dispatcher worker waits for follow-up events */
+    int             weight[MPR_DISPATCHER_CLASSES];  /**< Dispatchers to run per class in each scheduling round */
+    int             credit[MPR_DISPATCHER_CLASSES];  /**< Dispatchers remaining per class in the current round */
+    int             reserve[MPR_DISPATCHER_CLASSES]; /**< Workers reserved for each class */
+    int             statsEnabled;       /**< Collect event statistics */
+    uint64          loops;              /**< Event loop iterations while collecting statistics */
+    uint64          loopTime[MPR_EVENT_HIST]; /**< Histogram of event loop iteration time (excluding sleep) in usec */
+    uint64          maxLoopTime;        /**< Maximum event loop iteration time in usec */
+    MprSlowEvent    slowest[MPR_EVENT_SLOWEST]; /**< Slowest event callbacks, slowest first */
+    struct MprSignal *statsSignal;      /**< Signal handler to print event statistics */
     struct MprCond  *waitCond;          /**< Waiting sync */
     struct MprMutex *mutex;             /**< Multi-thread sync */
 } MprEventService;
@@ -5646,10 +5880,108 @@ typedef struct MprEventService {
  */
 PUBLIC void mprClearWaiting();
 
+/**
+    Set the event loop spin budget
+    @description By default, the event service blocks waiting for I/O when there are no events ready to run. If a
+        spin budget is defined, the event service will poll for I/O without blocking for the given number of microseconds
+        after the last activity before it blocks. While spinning, scheduling a dispatcher does not need to wake the
+        notifier which reduces latency at the cost of CPU consumption.
+    @param usec Spin budget in microseconds. Set to zero to disable spinning.
+    @return The previous spin budget.
+    @ingroup MprDispatcher
+    @stability Prototype
+ */
+PUBLIC int mprSetEventSpin(int usec);
+
+/**
+    Set the run-to-completion budget for sticky dispatchers
+    @description Dispatchers created with MPR_DISPATCHER_STICKY are preferentially run on the worker that last ran
+        them. After running its events, the worker waits up to the given time for follow-up events (such as the next 
+        I/O event on a connection) and runs them without returning the dispatcher to the event service. The worker 
+        returns to the idle pool when the time expires or after running the given count of events.
+    @param count Maximum number of events to run in one batch. Set to zero to disable batching.
+    @param timeout Time in milliseconds to wait for follow-up events. Set to zero to only run events that are
+        already due.
+    @ingroup MprDispatcher
+    @stability Prototype
+ */
+PUBLIC void mprSetDispatcherBatch(int count, MprTicks timeout);
+
+/**
+    Configure a dispatcher priority class
+    @description Ready dispatchers are selected using weighted round-robin across the priority classes. In each 
+        round, up to "weight" ready dispatchers of a class are run before the next class is considered. Higher
+        priority classes are considered first. Workers may also be reserved for a class so that latency critical 
+        dispatchers can always find a worker: dispatchers of lower priority classes will not start a worker if that 
+        would leave fewer than the reserved number of workers available.
+    @param priority Priority class. Set to MPR_DISPATCHER_CLASS_HIGH, MPR_DISPATCHER_CLASS_NORMAL or 
+        MPR_DISPATCHER_CLASS_LOW.
+    @param weight Number of dispatchers to run per round. Must be at least one. Defaults to 8, 4 and 1 respectively.
+    @param reserve Number of workers to reserve for the class and higher classes. Defaults to zero.
+    @return Zero if successful, otherwise a negative MPR error code.
+    @ingroup MprDispatcher
+    @stability Prototype
+ */
+PUBLIC int mprSetDispatcherClass(int priority, int weight, int reserve);
+
+/**
+    Set the priority class of a dispatcher
+    @description Dispatchers are created in the normal class unless MPR_DISPATCHER_HIGH or MPR_DISPATCHER_LOW is 
+        specified to mprCreateDispatcher.
+    @param dispatcher Dispatcher to modify
+    @param priority Priority class. Set to MPR_DISPATCHER_CLASS_HIGH, MPR_DISPATCHER_CLASS_NORMAL or 
+        MPR_DISPATCHER_CLASS_LOW.
+    @return Zero if successful, otherwise a negative MPR error code.
+    @ingroup MprDispatcher
+    @stability Prototype
+ */
+PUBLIC int mprSetDispatcherPriority(MprDispatcher *dispatcher, int priority);
+
+/**
+    Control the collection of event statistics
+    @description When enabled, each dispatcher records histograms of event scheduling delay and callback runtime. 
+        The event service records the event loop iteration time and the slowest callbacks by event name. 
+        Collection costs three clock reads per event. Enabling statistics resets all prior statistics.
+    @param enable Set to true to collect statistics.
+    @param signo Signal number that will print the statistics via mprPrintEventStats. Set to zero for none.
+    @ingroup MprDispatcher
+    @stability Prototype
+ */
+PUBLIC void mprSetEventStats(bool enable, int signo);
+
+/**
+    Get the event statistics for a dispatcher
+    @param dispatcher Dispatcher to examine
+    @return The dispatcher event statistics. Returns NULL if statistics are not enabled or if no events have run
+        on the dispatcher since they were enabled.
+    @ingroup MprDispatcher
+    @stability Prototype
+ */
+PUBLIC MprEventStats *mprGetDispatcherStats(MprDispatcher *dispatcher);
+
+/**
+    Get a percentile from an event statistics histogram
+    @param hist Histogram from MprEventStats or MprEventService
+    @param percent Percentile to compute (0-100)
+    @return The upper bound of the histogram bucket containing the percentile.
+    @ingroup MprDispatcher
+    @stability Prototype
+ */
+PUBLIC uint64 mprGetEventStatsPercentile(uint64 *hist, int percent);
+
+/**
+    Print event statistics to the log
+    @description Print the event loop iteration time, the slowest callbacks and the scheduling delay and runtime
+        for each dispatcher that has run events.
+    @ingroup MprDispatcher
+    @stability Prototype
+ */
+PUBLIC void mprPrintEventStats();
+
 /**
     Create a new event dispatcher
     @param name Useful name for debugging
-    @param flags Dispatcher flags.
+    @param flags Dispatcher flags. Set to MPR_DISPATCHER_HIGH or MPR_DISPATCHER_LOW to select a priority class.
     @returns a Dispatcher object that can manage events and be used with mprCreateEvent
     @ingroup MprDispatcher
     @stability Internal
@@ -5831,6 +6163,94 @@ PUBLIC MprEvent *mprCreateTimerEvent(MprDispatcher *dispatcher, cchar *name, Mpr
  */
 PUBLIC void mprRescheduleEvent(MprEvent *event, MprTicks period);
 
+/**
+    Deadline for the operations of a dispatcher
+    @description A deadline is a cancellation token attached to a dispatcher. When the deadline expires, pending events
+        on the dispatcher are removed, sockets added via #mprAddDeadlineSocket are shutdown so blocked I/O returns,
+        commands running on the dispatcher are stopped and threads waiting in #mprWaitForEvent or #mprWaitForCmd are 
+        woken. Expiry is tracked by a timer event on the non-blocking dispatcher.
+    @see mprAddDeadlineSocket mprCancelDeadline mprCreateDeadline mprGetDeadlineRemaining mprIsDeadlineExpired 
+        mprRemoveDeadline mprResetDeadline
+    @defgroup MprDeadline MprDeadline
+    @stability Prototype
+ */
+typedef struct MprDeadline {
+    MprTicks        expires;            /**< When the deadline expires */
+    MprEvent        *timer;             /**< Expiry timer event */
+    MprDispatcher   *dispatcher;        /**< Dispatcher governed by the deadline */
+    MprList         *sockets;           /**< Sockets to shutdown on expiry */
+    int             expired;            /**< Deadline has expired or been cancelled */
+} MprDeadline;
+
+/**
+    Add a socket to a deadline
+    @description When the deadline expires, the socket is shutdown so that blocking reads and writes return and
+        wait handlers see end of file.
+    @param deadline Deadline object created via #mprCreateDeadline
+    @param sp Socket object
+    @ingroup MprDeadline
+    @stability Prototype
+ */
+PUBLIC void mprAddDeadlineSocket(MprDeadline *deadline, struct MprSocket *sp);
+
+/**
+    Cancel a deadline
+    @description Immediately expire the deadline and cancel the operations of its dispatcher.
+    @param deadline Deadline object created via #mprCreateDeadline
+    @ingroup MprDeadline
+    @stability Prototype
+ */
+PUBLIC void mprCancelDeadline(MprDeadline *deadline);
+
+/**
+    Create a deadline for a dispatcher
+    @description Create a deadline and attach it to the dispatcher. Any prior deadline is removed. 
+        Events created with the #MPR_EVENT_NO_CANCEL flag are not cancelled on expiry.
+    @param dispatcher Dispatcher object created via #mprCreateDispatcher
+    @param timeout Time in milliseconds until the deadline expires
+    @return A deadline object
+    @ingroup MprDeadline
+    @stability Prototype
+ */
+PUBLIC MprDeadline *mprCreateDeadline(MprDispatcher *dispatcher, MprTicks timeout);
+
+/**
+    Get the time remaining before a deadline expires
+    @param deadline Deadline object created via #mprCreateDeadline. May be null.
+    @return Time in milliseconds. Returns zero if expired and MPR_MAX_TIMEOUT if deadline is null.
+    @ingroup MprDeadline
+    @stability Prototype
+ */
+PUBLIC MprTicks mprGetDeadlineRemaining(MprDeadline *deadline);
+
+/**
+    Test if a deadline has expired
+    @param deadline Deadline object created via #mprCreateDeadline. May be null.
+    @return True if the deadline has expired or been cancelled
+    @ingroup MprDeadline
+    @stability Prototype
+ */
+PUBLIC bool mprIsDeadlineExpired(MprDeadline *deadline);
+
+/**
+    Remove a deadline
+    @description Disarm the deadline and detach it from its dispatcher.
+    @param deadline Deadline object created via #mprCreateDeadline
+    @ingroup MprDeadline
+    @stability Prototype
+ */
+PUBLIC void mprRemoveDeadline(MprDeadline *deadline);
+
+/**
+    Reset a deadline
+    @description Rearm an unexpired deadline to expire after the given timeout.
+    @param deadline Deadline object created via #mprCreateDeadline
+    @param timeout Time in milliseconds until the deadline expires
+    @ingroup MprDeadline
+    @stability Prototype
+ */
+PUBLIC void mprResetDeadline(MprDeadline *deadline, MprTicks timeout);
+
 /**
     Relay an event to a dispatcher. This invokes the callback proc as though it was invoked from the given dispatcher. 
     @param dispatcher Dispatcher object created via #mprCreateDispatcher
@@ -5852,6 +6272,7 @@ PUBLIC int mprDispatchersAreIdle();
 PUBLIC int mprGetEventCount(MprDispatcher *dispatcher);
 PUBLIC MprEvent *mprGetNextEvent(MprDispatcher *dispatcher);
 PUBLIC MprDispatcher *mprGetNonBlockDispatcher();
+PUBLIC MprTicks mprGetPendingDispatcherDelay();
 PUBLIC void mprInitEventQ(MprEvent *q);
 PUBLIC void mprQueueTimerEvent(MprDispatcher *dispatcher, MprEvent *event);
 PUBLIC void mprReleaseWorkerFromDispatcher(MprDispatcher *dispatcher, struct MprWorker *worker);
@@ -6183,6 +6604,7 @@ typedef struct MprThreadService {
     struct MprThread *eventsThread;         /**< Event service thread */
     MprCond          *cond;                 /**< Multi-thread sync */
     ssize            stackSize;             /**< Default thread stack size */
+    void             *cpus;                 /**< Process CPU affinity mask (cpu_set_t) when the service was created */
 } MprThreadService;
 
 /**
@@ -6233,6 +6655,7 @@ typedef struct MprThread {
     int             stickyYield;        /**< Yielded does not auto-clear after GC */
     int             yielded;            /**< Thread has yielded to GC */
     int             waitForGC;          /**< Yield untill sweeper is complete */
+    char            *affinity;          /**< CPU list the thread is bound to (null for the process CPUs) */
 } MprThread;
 
 
@@ -6343,6 +6766,62 @@ PUBLIC void mprSetCurrentThreadPriority(int priority);
  */
 PUBLIC void mprSetThreadPriority(MprThread *thread, int priority);
 
+#if LINUX
+    #define MPR_AFFINITY 1              /**< Thread CPU affinity and NUMA placement are supported on this platform */
+#else
+    #define MPR_AFFINITY 0
+#endif
+
+/**
+    Set the CPU affinity for a thread
+    @description Bind the thread to run only on the given CPUs. If the thread has not yet started, the affinity is
+        applied when it starts.
+    @param thread Thread object returned by #mprCreateThread
+    @param cpus List of CPU numbers and ranges. For example: "0-3,8". Set to null to restore the process CPU mask.
+    @return Zero if successful. Returns MPR_ERR_BAD_ARGS if the list cannot be parsed or MPR_ERR_BAD_STATE if CPU 
+        affinity is not supported on this platform.
+    @ingroup MprThread
+    @stability Prototype
+ */
+PUBLIC int mprSetThreadAffinity(MprThread *thread, cchar *cpus);
+
+/**
+    Set the CPU affinity for the event service thread
+    @description Bind the thread servicing events to the given CPUs. This is the events thread if started via
+        #mprStartEventsThread, otherwise the main thread.
+    @param cpus List of CPU numbers and ranges. For example: "0-3,8". Set to null to restore the process CPU mask.
+    @return Zero if successful, otherwise a negative MPR error code.
+    @ingroup MprThread
+    @stability Prototype
+ */
+PUBLIC int mprSetEventsAffinity(cchar *cpus);
+
+/**
+    Set the CPU affinity for the garbage collector thread
+    @param cpus List of CPU numbers and ranges. For example: "0-3,8". Set to null to restore the process CPU mask.
+    @return Zero if successful. Returns MPR_ERR_BAD_STATE if the collector does not use a thread.
+    @ingroup MprThread
+    @stability Prototype
+ */
+PUBLIC int mprSetGCAffinity(cchar *cpus);
+
+/**
+    Get the number of NUMA nodes
+    @return The number of memory nodes. Returns 1 if the system is not NUMA or the topology is unknown.
+    @ingroup MprThread
+    @stability Prototype
+ */
+PUBLIC int mprGetNumaNodes();
+
+/**
+    Get the CPUs of a NUMA node
+    @param node Node number from zero to #mprGetNumaNodes minus one
+    @return List of CPU numbers and ranges. For example: "0-3,8". Returns null if the node is unknown.
+    @ingroup MprThread
+    @stability Prototype
+ */
+PUBLIC char *mprGetNumaNodeCpus(int node);
+
 /**
     Start a thread
     @description Start a thread previously created via #mprCreateThread. The thread will begin at the entry function 
@@ -6415,6 +6894,7 @@ typedef long (*MprMsgCallback)(HWND hwnd, UINT msg, UINT wp, LPARAM lp);
 typedef struct MprWaitService {
     MprList         *handlers;              /* List of handlers */
     int             needRecall;             /* A handler needs a recall due to buffered data */
+    struct MprWaitHandler *recallq;         /* Queue of handlers needing recall (linked via next/prev) */
     int             wakeRequested;          /* Wakeup of the wait service has been requested */
     MprList         *handlerMap;            /* Map of fds to handlers */
 #if MPR_EVENT_ASYNC
@@ -6426,6 +6906,10 @@ typedef struct MprWaitService {
 #elif MPR_EVENT_EPOLL
     int             epoll;                  /* Epoll descriptor */
     int             breakFd[2];             /* Event or pipe to wakeup */
+    int             timerFd;                /* Timerfd armed for the next due event. Set to -1 if not used */
+#if MPR_EVENT_IO_URING
+    struct MprUring *ring;                  /* io_uring instance. Null if using epoll */
+#endif
 #elif MPR_EVENT_KQUEUE
     int             kq;                     /* Kqueue() return descriptor */
 #elif MPR_EVENT_SELECT
@@ -6455,6 +6939,22 @@ PUBLIC void mprWakeNotifier();
 #if MPR_EVENT_EPOLL
     PUBLIC void mprManageEpoll(MprWaitService *ws, int flags);
 #endif
+#if MPR_EVENT_IO_URING
+    PUBLIC int  mprCreateUring(MprWaitService *ws);
+    PUBLIC void mprManageUring(MprWaitService *ws, int flags);
+    PUBLIC int  mprUringNotifyOn(MprWaitService *ws, struct MprWaitHandler *wp, int mask);
+    PUBLIC void mprUringWaitForIO(MprWaitService *ws, MprTicks timeout);
+    PUBLIC int  mprUringSubmit(MprWaitService *ws, struct MprIORequest *req);
+#endif
+#if MPR_EVENT_EPOLL && defined(TFD_NONBLOCK)
+    /*
+        The epoll notifier uses a timerfd to awake for the next due event
+     */
+    #define MPR_WAIT_TIMER 1
+    PUBLIC int  mprSetWaitTimer(MprWaitService *ws, MprTicks delay);
+#else
+    #define MPR_WAIT_TIMER 0
+#endif
 #if MPR_EVENT_SELECT
     PUBLIC void mprManageSelect(MprWaitService *ws, int flags);
 #endif
@@ -6510,7 +7010,7 @@ typedef struct MprWaitHandler {
     MprWaitService  *service;           /**< Wait service pointer */
     MprDispatcher   *dispatcher;        /**< Event dispatcher to use for I/O events */
     MprEventProc    proc;               /**< Callback event procedure */
-    struct MprWaitHandler *next;        /**< List linkage */
+    struct MprWaitHandler *next;        /**< Recall queue linkage */
     struct MprWaitHandler *prev;
     struct MprWorker *requiredWorker;   /**< Designate the required worker thread to run the callback */
     struct MprThread *thread;           /**< Thread executing the callback, set even if worker is null */
@@ -6585,6 +7085,75 @@ PUBLIC void mprWaitOn(MprWaitHandler *wp, int desiredMask);
  */
 PUBLIC void mprDoWaitRecall(MprWaitService *ws);
 
+/*
+    I/O request operations
+ */
+#define MPR_IO_READ                 1       /**< Read from a file descriptor at an offset */
+#define MPR_IO_RECV                 2       /**< Receive from a socket */
+#define MPR_IO_SEND                 3       /**< Send to a socket */
+
+/**
+    I/O completion callback
+    @param data Data argument supplied to #mprSubmitIO
+    @param req I/O request. The req->result field contains the count of bytes transferred or -1 on errors.
+    @ingroup MprWaitHandler
+    @stability Prototype
+ */
+typedef void (*MprIOCompletion)(void *data, struct MprIORequest *req);
+
+/**
+    Asynchronous I/O request
+    @description I/O requests are submitted via #mprSubmitIO and complete via a callback on a dispatcher. 
+        With the io_uring notifier, requests are submitted to the kernel and complete asynchronously. Otherwise,
+        the I/O is performed immediately and the completion callback is queued on the dispatcher.
+    @ingroup MprWaitHandler
+    @stability Prototype
+ */
+typedef struct MprIORequest {
+    int             op;                 /**< Request operation: MPR_IO_READ, MPR_IO_RECV or MPR_IO_SEND */
+    int             fd;                 /**< O/S file descriptor */
+    int             error;              /**< O/S error code if the request failed */
+    void            *buf;               /**< I/O buffer. Must be an allocated memory block */
+    ssize           size;               /**< Size of the I/O buffer */
+    MprOff          offset;             /**< File offset for MPR_IO_READ. Set to -1 for the current position */
+    ssize           result;             /**< Count of bytes transferred. Set to -1 on errors */
+    MprIOCompletion proc;               /**< Completion callback */
+    void            *data;              /**< Callback data */
+    MprDispatcher   *dispatcher;        /**< Dispatcher to run the completion callback */
+} MprIORequest;
+
+/**
+    Submit an asynchronous I/O request
+    @description Submit a file read, socket receive or socket send request. When the request completes, the
+        completion callback is invoked via the dispatcher. The buffer must not be modified until the request completes.
+    @param op I/O operation. Set to MPR_IO_READ, MPR_IO_RECV or MPR_IO_SEND.
+    @param fd File descriptor. For MPR_IO_RECV and MPR_IO_SEND, this must be a socket.
+    @param buf I/O buffer. This must be an allocated memory block. It will be retained until the request completes.
+    @param size Size of the I/O buffer
+    @param offset File offset for MPR_IO_READ. Set to -1 to read from the current file position.
+    @param dispatcher Dispatcher to use for the completion callback. Set to NULL to use the MPR dispatcher.
+    @param proc Completion callback of the form: void proc(void *data, MprIORequest *req)
+    @param data Data argument to pass to the callback. Must be an allocated memory block or NULL.
+    @return The I/O request object. Returns NULL if the request cannot be submitted.
+    @ingroup MprWaitHandler
+    @stability Prototype
+ */
+PUBLIC MprIORequest *mprSubmitIO(int op, int fd, void *buf, ssize size, MprOff offset, MprDispatcher *dispatcher, 
+    void *proc, void *data);
+
+/**
+    Test if I/O requests complete asynchronously
+    @return True if #mprSubmitIO requests are submitted to the kernel and complete asynchronously (io_uring).
+    @ingroup MprWaitHandler
+    @stability Prototype
+ */
+PUBLIC bool mprHasAsyncIO();
+
+/*
+    Internal
+ */
+PUBLIC void mprCompleteIO(MprIORequest *req);
+
 /******************************* Notification *********************************/
 /**
     Internal
@@ -6703,6 +7272,22 @@ typedef struct MprSocketProvider {
 */
 typedef int (*MprSocketPrebind)(struct MprSocket *sock);
 
+/**
+    Callback to resolve a host address
+    @description Resolvers are invoked for host addresses that are not in the socket service address cache.
+    @param ip Host name or IP address. Empty for a passive (listen on all interfaces) address.
+    @param port Port number
+    @param family Output parameter to contain the Internet protocol family
+    @param protocol Output parameter to contain the Internet TCP/IP protocol
+    @param addr Output storage to receive the resolved address
+    @param addrlen Output parameter to hold the length of the address
+    @return Zero if the call is successful. Otherwise return a negative MPR error code.
+    @ingroup MprSocket
+    @stability Prototype
+ */
+typedef int (*MprSocketResolver)(cchar *ip, int port, int *family, int *protocol, struct sockaddr_storage *addr, 
+    Socklen *addrlen);
+
 
 /**
     Mpr socket service class
@@ -6719,6 +7304,11 @@ typedef struct MprSocketService {
     int             maxAccept;                  /**< Maximum number of accepted client socket connections */
     int             numAccept;                  /**< Count of client socket connections */
     int             hasIPv6;                    /**< System has supoprt for IPv6 */
+    int             busyPoll;                   /**< SO_BUSY_POLL microseconds for new sockets */
+    MprHash         *dnsCache;                  /**< Resolved host addresses */
+    MprSocketResolver resolver;                 /**< Host resolver for addresses not in the cache */
+    MprTicks        dnsTimeout;                 /**< Lifespan of cached host addresses */
+    MprTicks        dnsFailTimeout;             /**< Lifespan of cached host resolution failures */
 } MprSocketService;
 
 #if DOXYGEN
@@ -6746,6 +7336,17 @@ PUBLIC bool mprHasSecureSockets();
  */
 PUBLIC int mprSetMaxSocketAccept(int max);
 
+/**
+    Set the busy-poll period for new sockets
+    @description Request that the kernel busy-poll the device receive queue for the given period when reading from
+        accepted and connected sockets (SO_BUSY_POLL). This is ignored on systems without SO_BUSY_POLL.
+        Use with #mprSetEventSpin for lowest latency.
+    @param usec Busy-poll period in microseconds. Set to zero to disable.
+    @ingroup MprSocket
+    @stability Prototype
+ */
+PUBLIC void mprSetSocketBusyPoll(int usec);
+
 /**
     Add a secure socket provider for SSL communications
     @param name Name of the secure socket provider
@@ -6785,6 +7386,14 @@ PUBLIC void mprAddSocketProvider(cchar *name, MprSocketProvider *provider);
 #define MPR_SOCKET_CHECKED          0x2000  /**< Peer certificate has been checked */
 #define MPR_SOCKET_DISCONNECTED     0x4000  /**< The mprDisconnectSocket has been called */
 #define MPR_SOCKET_HANDSHAKING      0x8000  /**< Doing an SSL handshake */
+#define MPR_SOCKET_REUSEPORT        0x10000 /**< Set SO_REUSEPORT so several listeners can share a port */
+#define MPR_SOCKET_REUSEPORT_CPU    0x20000 /**< Steer connections to sharded listeners by receiving CPU */
+#define MPR_SOCKET_ZEROCOPY         0x40000 /**< SO_ZEROCOPY is enabled for MSG_ZEROCOPY sends */
+
+/*
+    Splice flags
+ */
+#define MPR_SPLICE_TEE              0x1     /**< Duplicate pipe data without consuming it */
 
 /**
     Socket Service
@@ -6795,14 +7404,15 @@ PUBLIC void mprAddSocketProvider(cchar *name, MprSocketProvider *provider);
     The socket service integrates with the MPR worker thread pool and eventing services. Socket connections can be handled
     by threads from the worker thread pool for scalable, multithreaded applications.
     @stability Stable
-    @see MprSocket MprSocketPrebind MprSocketProc MprSocketProvider MprSocketService mprAddSocketHandler 
-        mprCloseSocket mprConnectSocket mprCreateSocket mprCreateSocketService mprCreateSsl mprCloneSsl
-        mprDisconnectSocket mprEnableSocketEvents mprFlushSocket mprGetSocketBlockingMode mprGetSocketError 
-        mprGetSocketFd mprGetSocketInfo mprGetSocketPort mprGetSocketState mprHasSecureSockets mprIsSocketEof
-        mprIsSocketSecure mprListenOnSocket mprLoadSsl mprParseIp mprReadSocket mprSendFileToSocket mprSetSecureProvider
-        mprSetSocketBlockingMode mprSetSocketCallback mprSetSocketEof mprSetSocketNoDelay mprSetSslCaFile mprSetSslCaPath
+    @see MprSocket MprSocketPrebind MprSocketProc MprSocketProvider MprSocketService mprAcceptSocket mprAcceptSockets
+        mprAddSocketHandler mprCloseSocket mprConnectSocket mprCreateSocket mprCreateSocketService mprCreateSsl mprCloneSsl
+        mprDisconnectSocket mprEnableSocketEvents mprFlushSocket mprGetSocketAcceptIp mprGetSocketBlockingMode 
+        mprGetSocketError mprGetSocketFd mprGetSocketInfo mprGetSocketIp mprGetSocketPort mprGetSocketState mprHasSecureSockets mprIsSocketEof
+        mprIsSocketSecure mprListenOnSocket mprListenOnSockets mprLoadSsl mprParseIp mprReadSocket mprReadSocketBatch
+        mprResolveSocketInfo mprSendFileToSocket mprSetSecureProvider mprSpliceToSocket mprSetSocketBlockingMode mprSetSocketCallback
+        mprSetSocketEof mprSetSocketNoDelay mprSetSocketResolver mprSetSocketResolverCache mprSetSslCaFile mprSetSslCaPath
         mprSetSslCertFile mprSetSslCiphers mprSetSslKeyFile mprSetSslSslProtocols mprSetSslVerifySslClients mprWriteSocket
-        mprWriteSocketString mprWriteSocketVector mprSocketHandshaking mprSocketHasBufferedRead mprSocketHasBufferedWrite
+        mprWriteSocketBatch mprWriteSocketString mprWriteSocketVector mprWriteSocketZeroCopy mprSocketHandshaking mprSocketHasBufferedRead mprSocketHasBufferedWrite
         mprUpgradeSocket 
     @defgroup MprSocket MprSocket
     @stability Internal
@@ -6810,8 +7420,8 @@ PUBLIC void mprAddSocketProvider(cchar *name, MprSocketProvider *provider);
 typedef struct MprSocket {
     MprSocketService *service;          /**< Socket service */
     MprWaitHandler  *handler;           /**< Wait handler */
-    char            *acceptIp;          /**< Server addresss that accepted a new connection (actual interface) */
-    char            *ip;                /**< Server listen address or remote client address */
+    char            *acceptIp;          /**< Server address that accepted a connection. See mprGetSocketAcceptIp */
+    char            *ip;                /**< Server listen address or remote client address. See mprGetSocketIp */
     char            *errorMsg;          /**< Connection related error messages */
     int             acceptPort;         /**< Server port doing the listening */
     int             port;               /**< Port to listen or connect on */
@@ -6822,6 +7432,13 @@ typedef struct MprSocket {
     void            *sslSocket;         /**< Extended SSL socket state */
     struct MprSsl   *ssl;               /**< SSL configuration */
     MprMutex        *mutex;             /**< Multi-thread sync */
+    MprList         *zeroCopy;          /**< MSG_ZEROCOPY sends awaiting completion */
+    uint            zeroCopySeq;        /**< Sequence number of the next MSG_ZEROCOPY send */
+    struct MprEvent *zeroCopyTimer;     /**< Timer reaping MSG_ZEROCOPY completions while sends are outstanding */
+    int             pipe[2];            /**< Pipe for tee forwarding. See mprSpliceToSocket */
+    ssize           pipeLen;            /**< Bytes in the pipe not yet written to the socket */
+    Socklen         addrlen;            /**< Length of addr */
+    struct sockaddr_storage addr;       /**< Remote address of an accepted connection or resolved datagram destination */
 } MprSocket;
 
 
@@ -6837,6 +7454,8 @@ typedef struct MprIOVec {
 
 /**
     Accept an incoming connection
+    @description The remote address and the address of the accepting interface are available in sp->ip,
+        sp->acceptIp and sp->acceptPort.
     @param listen Listening server socket
     @returns A new socket connection
     @ingroup MprSocket
@@ -6844,6 +7463,21 @@ typedef struct MprIOVec {
  */
 PUBLIC MprSocket *mprAcceptSocket(MprSocket *listen);
 
+/**
+    Accept a batch of incoming connections
+    @description Accepts pending connections until none remain or max connections have been accepted. 
+        This is more efficient than #mprAcceptSocket when many connections arrive at once. Remote addresses are not
+        formatted until requested: sp->ip and sp->acceptIp are null until #mprGetSocketIp and
+        #mprGetSocketAcceptIp are called. A blocking listener accepts at most one connection.
+    @param listen Listening server socket
+    @param sockets Array to receive the new socket connections
+    @param max Maximum number of connections to accept. This is the size of the sockets array.
+    @return The number of connections accepted
+    @ingroup MprSocket
+    @stability Prototype
+ */
+PUBLIC int mprAcceptSockets(MprSocket *listen, MprSocket **sockets, int max);
+
 /**
     Add a wait handler to a socket.
     @description Create a wait handler that will be invoked when I/O of interest occurs on the specified socket.
@@ -6961,6 +7595,7 @@ PUBLIC Socket mprGetSocketFd(MprSocket *sp);
 
 /**
     Get the socket for an IP:Port address
+    @description Host addresses are cached by the socket service. See #mprSetSocketResolverCache.
     @param ip IP address or hostname 
     @param port Port number 
     @param family Output parameter to contain the Internet protocol family
@@ -6973,6 +7608,42 @@ PUBLIC Socket mprGetSocketFd(MprSocket *sp);
   */
 PUBLIC int mprGetSocketInfo(cchar *ip, int port, int *family, int *protocol, struct sockaddr **addr, Socklen *addrlen);
 
+/**
+    Resolve a host address in the background
+    @description Resolve the host address on a worker thread and store it in the socket service address cache.
+        Event loop callers can use this so that a subsequent #mprConnectSocket does not block on name resolution.
+    @param ip IP address or hostname 
+    @param dispatcher Dispatcher to run the callback. Set to null to use the MPR dispatcher.
+    @param proc Event callback to invoke when the address is resolved. May be null.
+    @param data Data to pass to the callback as event->data.
+    @return Zero if the resolution was started or the address is already cached. Otherwise return a negative MPR error code.
+    @ingroup MprSocket
+    @stability Prototype
+  */
+PUBLIC int mprResolveSocketInfo(cchar *ip, MprDispatcher *dispatcher, void *proc, void *data);
+
+/**
+    Define the host resolver
+    @description The resolver is invoked for host addresses that are not in the address cache. This flushes the cache.
+    @param resolver Resolver callback. Set to null to use getaddrinfo.
+    @ingroup MprSocket
+    @stability Prototype
+  */
+PUBLIC void mprSetSocketResolver(MprSocketResolver resolver);
+
+/**
+    Configure the host address cache
+    @description Resolved addresses are cached by host name. Expired addresses continue to be used while they are
+        refreshed in the background. If a refresh fails, the last good address is used for up to one more cache
+        period. Resolution failures are only cached if failTimeout is set. This flushes the cache.
+    @param timeout Lifespan of a cached address in milliseconds. Set to zero to disable caching.
+    @param failTimeout Lifespan of a cached resolution failure in milliseconds. Set to zero to not cache failures.
+        This is the default.
+    @ingroup MprSocket
+    @stability Prototype
+  */
+PUBLIC void mprSetSocketResolverCache(MprTicks timeout, MprTicks failTimeout);
+
 /**
     Get the port used by a socket
     @description Get the TCP/IP port number used by the socket.
@@ -6983,6 +7654,27 @@ PUBLIC int mprGetSocketInfo(cchar *ip, int port, int *family, int *protocol, str
  */
 PUBLIC int mprGetSocketPort(MprSocket *sp);
 
+/**
+    Get the socket IP address
+    @description For accepted connections, this is the remote client address. It is formatted on first use.
+        For other sockets, this is the address given to #mprListenOnSocket or #mprConnectSocket.
+    @param sp Socket object returned from #mprCreateSocket
+    @return The IP address string or null if not available.
+    @ingroup MprSocket
+    @stability Prototype
+ */
+PUBLIC cchar *mprGetSocketIp(MprSocket *sp);
+
+/**
+    Get the server interface address that accepted a connection
+    @description This is determined on first use and also updates sp->acceptPort.
+    @param sp Accepted socket returned from #mprAcceptSocket or #mprAcceptSockets
+    @return The IP address string or null if the socket was not accepted.
+    @ingroup MprSocket
+    @stability Prototype
+ */
+PUBLIC cchar *mprGetSocketAcceptIp(MprSocket *sp);
+
 /**
     Get the socket state
     @description Get the socket state as a parseable string description
@@ -7074,12 +7766,31 @@ PUBLIC bool mprIsSocketEof(MprSocket *sp);
         @li MPR_SOCKET_NOREUSE - Set NOREUSE flag on the socket
         @li MPR_SOCKET_NODELAY - Set NODELAY on the socket
         @li MPR_SOCKET_THREAD - Process callbacks on a separate thread.
+        @li MPR_SOCKET_REUSEPORT - Set SO_REUSEPORT so other listeners may bind the same address and port.
     @return Zero if the connection is successful. Otherwise a negative MPR error code.
     @ingroup MprSocket
     @stability Stable
  */
 PUBLIC Socket mprListenOnSocket(MprSocket *sp, cchar *ip, int port, int flags);
 
+/**
+    Listen on a set of sharded server sockets
+    @description Open several listening sockets bound to the same address and port using SO_REUSEPORT. 
+        The kernel distributes incoming connections over the listeners so that each one can be served by a separate
+        dispatcher or worker group without sharing a single accept queue. Add a wait handler to each returned socket
+        via #mprAddSocketHandler. If SO_REUSEPORT is not supported, a single listener is returned.
+    @param ip IP address to bind to. Set to 0.0.0.0 to bind to all possible addresses on a given port.
+    @param port TCP/IP port number to listen on. This must not be zero.
+    @param flags Socket flags as for #mprListenOnSocket. MPR_SOCKET_REUSEPORT is always set. Add
+        MPR_SOCKET_REUSEPORT_CPU to steer each connection to the listener whose index is the receiving CPU modulo the
+        number of listeners. This is only useful if listener N is served by a thread running on CPU N.
+    @param count Number of listeners to create. Set to zero to create one per CPU.
+    @return A list of listening MprSocket objects. Returns null if any listener cannot be created.
+    @ingroup MprSocket
+    @stability Prototype
+ */
+PUBLIC MprList *mprListenOnSockets(cchar *ip, int port, int flags, int count);
+
 /**
     Parse an socket address IP address. 
     @description This parses a string containing an IP:PORT specification and returns the IP address and port 
@@ -7112,6 +7823,21 @@ PUBLIC int mprParseSocketAddress(cchar *address, char **ip, int *port, int *secu
  */
 PUBLIC ssize mprReadSocket(MprSocket *sp, void *buf, ssize size);
 
+/**
+    Read a batch of datagrams from a socket
+    @description Read up to count datagrams from a datagram socket using a single system call where supported (recvmmsg).
+        Each datagram is read into the next buffer and the buffer length is updated to the size of the datagram received.
+        Datagrams larger than the buffer are truncated. This call does not block for more than the first datagram.
+    @param sp Socket object opened with MPR_SOCKET_DATAGRAM
+    @param bufs Vector of buffers to receive datagrams. The len field of each buffer is updated.
+    @param count Number of buffers in bufs
+    @return The number of datagrams read. Returns zero if none are available on a non-blocking socket.
+        Return a negative MPR error code on errors.
+    @ingroup MprSocket
+    @stability Prototype
+ */
+PUBLIC int mprReadSocketBatch(MprSocket *sp, MprIOVec *bufs, int count);
+
 /**
     Remove a socket wait handler.
     @description Removes the socket wait handler created via mprAddSocketHandler.
@@ -7126,7 +7852,8 @@ PUBLIC void mprRemoveSocketHandler(MprSocket *sp);
     Send a file to a socket
     @description Write the contents of a file to a socket. If the socket is in non-blocking mode (the default), the write
         may return having written less than the required bytes. This API permits the writing of data before and after
-        the file contents. 
+        the file contents. If the file is shorter than expected, the available data is written without the trailing
+        data and the count is short.
     @param file File to write to the socket
     @param sock Socket object returned from #mprCreateSocket
     @param offset offset within the file from which to read data
@@ -7141,6 +7868,23 @@ PUBLIC void mprRemoveSocketHandler(MprSocket *sp);
  */
 PUBLIC MprOff mprSendFileToSocket(MprSocket *sock, MprFile *file, MprOff offset, MprOff bytes, MprIOVec *beforeVec, 
     int beforeCount, MprIOVec *afterVec, int afterCount);
+
+/**
+    Forward data from a pipe to a socket
+    @description Move data from a pipe, such as the output of a command (see #mprGetCmdFd), to a socket using splice
+        so the data is not copied through user space. With MPR_SPLICE_TEE, the data is duplicated using tee and left in 
+        the pipe for its normal reader, which must consume the returned count before calling again. SSL sockets and 
+        systems without splice read and write the data instead.
+    @param sp Socket object returned from #mprCreateSocket
+    @param fd Pipe file descriptor to read from
+    @param len Maximum number of bytes to forward
+    @param flags Set to MPR_SPLICE_TEE to leave the data in the pipe
+    @return A count of bytes forwarded. Returns zero if the pipe is empty or the socket cannot absorb any more data.
+        Returns -1 if the pipe is at end of file and a negative MPR error code on other errors.
+    @ingroup MprSocket
+    @stability Prototype
+ */
+PUBLIC ssize mprSpliceToSocket(MprSocket *sp, int fd, ssize len, int flags);
 #endif
 
 /**
@@ -7241,6 +7985,41 @@ PUBLIC int mprUpgradeSocket(MprSocket *sp, struct MprSsl *ssl, cchar *peerName);
  */
 PUBLIC ssize mprWriteSocket(MprSocket *sp, cvoid *buf, ssize len);
 
+/**
+    Write a batch of datagrams to a socket
+    @description Send each buffer as a separate datagram to the destination given to #mprConnectSocket using a single
+        system call where supported (sendmmsg). The destination address is resolved once when the socket is opened.
+    @param sp Socket object opened with MPR_SOCKET_DATAGRAM or MPR_SOCKET_BROADCAST
+    @param bufs Vector of datagrams to send
+    @param count Number of datagrams in bufs
+    @return The number of datagrams sent. This may be less than count if the socket cannot absorb any more data. 
+        Return a negative MPR error code on errors.
+    @ingroup MprSocket
+    @stability Prototype
+ */
+PUBLIC int mprWriteSocketBatch(MprSocket *sp, MprIOVec *bufs, int count);
+
+/**
+    Write to a socket without copying the data
+    @description Send a large buffer using MSG_ZEROCOPY where supported. The kernel references the buffer pages until the
+        data has been sent, so the buffer must not be modified or freed until the callback runs. Completions are collected
+        from the socket error queue when the socket is next read or written, or by a timer while sends are outstanding.
+        They are delivered as events on the dispatcher of the socket wait handler. If the socket is closed before the
+        kernel reports a completion, the callback event has MPR_EVENT_ABORTED set in event->flags. The kernel may still
+        reference the buffer, so it should be released rather than reused. Small writes, SSL sockets and systems
+        without MSG_ZEROCOPY use a copying write and the callback is queued immediately.
+    @param sp Socket object returned from #mprCreateSocket
+    @param buf Buffer to write
+    @param len Length of the buffer
+    @param proc Event callback to invoke as proc(data, event) when the buffer may be reused. May be null.
+    @param data Data to pass to the callback as event->data
+    @return A count of bytes actually written. Returns zero if the socket cannot absorb any more data. The callback
+        is only invoked if this is greater than zero. Return a negative MPR error code on errors.
+    @ingroup MprSocket
+    @stability Prototype
+ */
+PUBLIC ssize mprWriteSocketZeroCopy(MprSocket *sp, cvoid *buf, ssize len, void *proc, void *data);
+
 /**
     Write to a string to a socket
     @description Write a string  to a socket. If the socket is in non-blocking mode (the default), the write
@@ -7491,6 +8270,12 @@ typedef struct MprWorkerStats {
     int     idle;           /**< Number of idle workers */
     int     busy;           /**< Number of busy workers */
     int     yielded;        /**< Number of busy workers yielded for GC */
+    int     queued;         /**< Number of tasks waiting in worker run queues */
+    int     steals;         /**< Number of tasks run by a worker other than the one they were queued on */
+    int     target;         /**< Adaptive limit of running (non-yielded) workers. Zero if adaptive sizing is disabled */
+    int     delay;          /**< Last observed wait in milliseconds of the oldest dispatcher pending for a worker */
+    int     grown;          /**< Number of times the adaptive limit was raised */
+    int     shrunk;         /**< Number of times the adaptive limit was lowered */
 } MprWorkerStats;
 
 /**
@@ -7510,6 +8295,10 @@ PUBLIC void mprGetWorkerStats(MprWorkerStats *stats);
 typedef struct MprWorkerService {
     MprList         *busyThreads;       /**< List of threads to service tasks */
     MprList         *idleThreads;       /**< List of threads to service tasks */
+    MprList         *workers;           /**< List of all workers. Scanned without locking to steal queued tasks */
+    volatile int    queued;             /**< Number of tasks in worker run queues. Updated atomically */
+    volatile int    steals;             /**< Number of stolen tasks */
+    int             nextVictim;         /**< Next worker to receive a queued task */
     int             maxThreads;         /**< Max # threads in worker pool */
     int             maxUsedThreads;     /**< Max threads ever used */
     int             minThreads;         /**< Max # threads in worker pool */
@@ -7518,7 +8307,16 @@ typedef struct MprWorkerService {
     ssize           stackSize;          /**< Stack size for worker threads */
     MprMutex        *mutex;             /**< Per task synchronization */
     struct MprEvent *pruneTimer;        /**< Timer for excess threads pruner */
+    struct MprEvent *tuneTimer;         /**< Timer for the adaptive pool sizing controller */
     MprWorkerProc   startWorker;        /**< Worker thread startup hook */
+    char            *affinity;          /**< CPU list for workers (null for the process CPUs) */
+    int             affinityFlags;      /**< Worker placement flags (MPR_AFFINITY_NODES) */
+    int             nextNode;           /**< Next NUMA node for worker placement */
+    MprTicks        latency;            /**< Target wait for dispatchers pending for a worker. Zero if not adaptive */
+    MprTicks        delay;              /**< Last observed wait of the oldest pending dispatcher */
+    int             target;             /**< Adaptive limit of running (non-yielded) workers */
+    int             grown;              /**< Number of times the adaptive limit was raised */
+    int             shrunk;             /**< Number of times the adaptive limit was lowered */
 } MprWorkerService;
 
 
@@ -7532,7 +8330,8 @@ PUBLIC void mprSetWorkerStartCallback(MprWorkerProc start);
 
 /**
     Get the count of available worker threads
-    Return the count of free threads in the worker thread pool.
+    Return the count of free threads in the worker thread pool. This includes idle workers and workers that can still
+    be started.
     @returns An integer count of worker threads.
     @ingroup MprWorker
     @stability Stable
@@ -7547,6 +8346,25 @@ PUBLIC int mprAvailableWorkers();
  */
 PUBLIC void mprSetWorkerStackSize(int size);
 
+/*
+    Flags for mprSetWorkerAffinity
+ */
+#define MPR_AFFINITY_NODES  0x1     /**< Place workers round-robin on NUMA nodes and prefer stealing on the same node */
+
+/**
+    Set the CPU affinity for worker threads
+    @description Bind existing and future worker threads to the given CPUs. With MPR_AFFINITY_NODES, the worker pool 
+        is partitioned by NUMA node: each worker is bound to the CPUs of one node and idle workers steal queued tasks 
+        from workers on their own node before other nodes.
+    @param cpus List of CPU numbers and ranges. For example: "0-3,8". Set to null to restore the process CPU mask. 
+        Ignored if flags include MPR_AFFINITY_NODES.
+    @param flags Set to MPR_AFFINITY_NODES to place workers per NUMA node.
+    @return Zero if successful, otherwise a negative MPR error code.
+    @ingroup MprWorker
+    @stability Prototype
+ */
+PUBLIC int mprSetWorkerAffinity(cchar *cpus, int flags);
+
 /**
     Set the minimum count of worker threads
     Set the count of threads the worker pool will have. This will cause the worker pool to pre-create at least this 
@@ -7567,6 +8385,20 @@ PUBLIC void mprSetMinWorkers(int count);
  */
 PUBLIC void mprSetMaxWorkers(int count);
 
+/**
+    Set the worker pool latency target
+    @description Enable adaptive sizing of the worker pool. By default, workers are only started while there are 
+        spare CPU cores. When enabled, a controller raises the limit of running workers when dispatchers wait for a 
+        worker longer than the latency target and lowers it toward the CPU count when workers are idle. 
+        Workers blocked in I/O (yielded) are not counted as running. Excess idle workers are pruned after 
+        #MPR_TIMEOUT_WORKER_TUNE. The pool remains within the limits set by #mprSetMinWorkers and #mprSetMaxWorkers.
+        The controller decisions are reported by #mprGetWorkerStats.
+    @param latency Target time in milliseconds a dispatcher may wait for a worker. Set to zero to disable.
+    @ingroup MprWorker
+    @stability Prototype
+ */
+PUBLIC void mprSetWorkerLatency(MprTicks latency);
+
 /**
     Get the maximum count of worker pool threads
     Get the maximum limit of worker pool threads. 
@@ -7583,6 +8415,18 @@ PUBLIC int mprGetMaxWorkers();
 #define MPR_WORKER_PRUNED      0x2          /**< Worker has been pruned and will be terminated */
 #define MPR_WORKER_IDLE        0x4          /**< Worker is sleeping (idle) on idleCond */
 
+#define MPR_WORKER_QUEUE       32           /**< Capacity of each worker run queue */
+
+/**
+    Task waiting in a worker run queue
+    @stability Internal
+ */
+typedef struct MprWorkerTask {
+    MprWorkerProc   proc;                   /**< Procedure to run */
+    void            *data;                  /**< Procedure data */
+    MprTicks        queued;                 /**< When the task was queued */
+} MprWorkerTask;
+
 /**
     Worker thread structure. Worker threads are allocated and dedicated to tasks. When idle, they are stored in
     an idle worker pool. An idle worker pruner runs regularly and terminates idle workers to save memory.
@@ -7602,6 +8446,11 @@ typedef struct MprWorker {
     MprTicks        lastActivity;           /**< When the worker was last used */
     MprWorkerService *workerService;        /**< Worker service */
     MprCond         *idleCond;              /**< Used to wait for work */
+    MprSpin         *spin;                  /**< Run queue lock */
+    MprWorkerTask   queue[MPR_WORKER_QUEUE]; /**< Run queue of tasks to service after the current task */
+    int             qfirst;                 /**< Index of the oldest task in the run queue */
+    int             qcount;                 /**< Count of tasks in the run queue */
+    int             node;                   /**< NUMA node if workers are placed per node, otherwise -1 */
 } MprWorker;
 
 /*
@@ -7637,14 +8486,154 @@ PUBLIC void mprReleaseWorker(MprWorker *worker);
 
 /**
     Start a worker thread
-    @description Start a worker thread executing the given worker procedure callback.
+    @description Start a worker thread executing the given worker procedure callback. If there are no idle workers
+        and no more workers can be created, the callback is queued on the run queue of a busy worker that is not 
+        blocked in user code. A worker drains its run queue and then steals from the run queues of other workers before
+        going idle. A queued callback may wait for the task ahead of it on that worker to complete unless another 
+        worker becomes idle and steals it.
+        \n\n
+        Prior releases returned MPR_ERR_BUSY whenever no worker was idle. MPR_ERR_BUSY is now returned only when
+        all busy workers are blocked or their run queues are full. Callers that need a dedicated thread should check
+        #mprAvailableWorkers first.
     @param proc Worker procedure callback
     @param data Data parameter to the callback
-    @returns Zero if successful, otherwise a negative MPR error code.
+    @returns Zero if successful, otherwise a negative MPR error code. Returns MPR_ERR_BUSY if the callback cannot be
+        started or queued.
     @stability Internal
  */
 PUBLIC int mprStartWorker(MprWorkerProc proc, void *data);
 
+/**
+    Start a callback on a preferred worker thread
+    @description If the preferred worker is idle, it is woken to run the callback so that the callback runs on a
+        thread with warm caches. Otherwise this behaves like mprStartWorker.
+    @param worker Preferred worker. Set to NULL for no preference.
+    @param proc Worker procedure callback
+    @param data Data parameter to the callback
+    @returns Zero if successful, otherwise a negative MPR error code.
+    @stability Internal
+ */
+PUBLIC int mprStartPreferredWorker(MprWorker *worker, MprWorkerProc proc, void *data);
+
+/*********************************** Fibers ***********************************/
+
+#if LINUX && !__UCLIBC__
+    #define MPR_FIBER 1                 /**< Fibers are supported on this platform */
+#else
+    #define MPR_FIBER 0
+#endif
+
+#define MPR_FIBER_STACK     (64 * 1024) /**< Default fiber stack size */
+
+/*
+    Fiber states
+ */
+#define MPR_FIBER_READY     0x1         /**< Fiber created and waiting to start */
+#define MPR_FIBER_RUNNING   0x2         /**< Fiber is running */
+#define MPR_FIBER_WAITING   0x4         /**< Fiber is suspended in mprAwaitIO or mprAwaitEvent */
+#define MPR_FIBER_COMPLETE  0x8         /**< Fiber procedure has returned */
+
+/**
+    Fiber procedure
+    @param data Data argument supplied to mprCreateFiber
+    @ingroup MprFiber
+    @stability Prototype
+ */
+typedef void (*MprFiberProc)(void *data);
+
+/**
+    Fiber (stackful coroutine)
+    @description Fibers run a procedure on their own stack as an event on a dispatcher. A fiber can suspend itself
+        to wait for I/O or a signal without blocking a worker thread. When the wait completes, the fiber is resumed 
+        by running an event on its dispatcher. As dispatchers run one event at a time, the fibers of a dispatcher 
+        never run concurrently. A fiber may resume on a different worker thread to the one on which it suspended.
+        The garbage collector does not scan stacks. As with any code that yields, memory referenced only by fiber 
+        local variables may be collected while the fiber is suspended. Retain such memory via the fiber data or
+        mprAddRoot.
+    @defgroup MprFiber MprFiber
+    @see MprFiberProc mprAwaitEvent mprAwaitIO mprCreateFiber mprGetCurrentFiber mprResumeFiber
+    @stability Prototype
+ */
+typedef struct MprFiber {
+    MprFiberProc    proc;               /**< Fiber procedure */
+    void            *data;              /**< Fiber procedure data */
+    MprDispatcher   *dispatcher;        /**< Dispatcher running the fiber */
+    MprEvent        *timer;             /**< Timeout event while waiting */
+    char            *stack;             /**< Fiber stack */
+    ssize           stackSize;          /**< Size of the fiber stack */
+    int             state;              /**< Fiber state (MPR_FIBER_*) */
+    int             waitMask;           /**< I/O wait mask (zero if waiting for a signal) */
+    int             result;             /**< Result of the last wait */
+    int             signalled;          /**< Fiber signalled via mprResumeFiber while not waiting */
+    int             value;              /**< Value supplied to mprResumeFiber */
+    int             ownDispatcher;      /**< Dispatcher was created for the fiber and is destroyed when it completes */
+#if MPR_FIBER
+    ucontext_t      context;            /**< Fiber machine context */
+    ucontext_t      caller;             /**< Context of the dispatcher event that resumed the fiber */
+#endif
+} MprFiber;
+
+/**
+    Await a signal in a fiber
+    @description Suspend the current fiber until mprResumeFiber is called or the timeout expires. If the fiber was
+        signalled via mprResumeFiber since the last wait, this returns immediately.
+    @param timeout Time in milliseconds to wait. Set to -1 to wait forever.
+    @return The value passed to mprResumeFiber. Returns MPR_ERR_TIMEOUT if the timeout expires and 
+        MPR_ERR_BAD_STATE if not called from a fiber.
+    @ingroup MprFiber
+    @stability Prototype
+ */
+PUBLIC int mprAwaitEvent(MprTicks timeout);
+
+/**
+    Await I/O on a socket in a fiber
+    @description Suspend the current fiber until the socket is readable or writable as requested. A socket wait 
+        handler is created on first use and reused by subsequent waits. The socket must not have a wait handler 
+        added via mprAddSocketHandler.
+    @param sp Socket to wait on
+    @param mask Mask of events of interest. This is made by oring MPR_READABLE and MPR_WRITABLE.
+    @param timeout Time in milliseconds to wait. Set to -1 to wait forever.
+    @return The mask of ready I/O events. Returns zero if the timeout expires. Returns a negative MPR error code
+        if not called from a fiber or if the socket has a foreign wait handler.
+    @ingroup MprFiber
+    @stability Prototype
+ */
+PUBLIC int mprAwaitIO(MprSocket *sp, int mask, MprTicks timeout);
+
+/**
+    Create and start a fiber
+    @description The fiber procedure is started by an event on the given dispatcher. The fiber is retained until
+        its procedure returns.
+    @param dispatcher Dispatcher to run the fiber. If NULL, a new dispatcher is created for the fiber and destroyed
+        when the fiber procedure returns.
+    @param proc Fiber procedure
+    @param data Data argument to the fiber procedure. This is marked for the garbage collector by the fiber.
+    @param stackSize Fiber stack size. Set to zero for the default of MPR_FIBER_STACK.
+    @return The fiber object. Returns NULL if fibers are not supported or if memory cannot be allocated.
+    @ingroup MprFiber
+    @stability Prototype
+ */
+PUBLIC MprFiber *mprCreateFiber(MprDispatcher *dispatcher, MprFiberProc proc, void *data, ssize stackSize);
+
+/**
+    Get the current fiber
+    @return The fiber running on the current thread. Returns NULL if not called from a fiber.
+    @ingroup MprFiber
+    @stability Prototype
+ */
+PUBLIC MprFiber *mprGetCurrentFiber();
+
+/**
+    Resume a fiber waiting in mprAwaitEvent
+    @description This routine may be called from any thread. The fiber is resumed via an event on its dispatcher. 
+        If the fiber is not waiting, it is marked as signalled and its next call to mprAwaitEvent returns immediately.
+    @param fiber Fiber to resume
+    @param value Value to return from mprAwaitEvent. Should be zero or positive.
+    @ingroup MprFiber
+    @stability Prototype
+ */
+PUBLIC void mprResumeFiber(MprFiber *fiber, int value);
+
 /********************************** Crypto ************************************/
 /**
     Return a random number
@@ -7863,6 +8852,15 @@ PUBLIC char *mprUriDecodeInSitu(char *uri);
     #define MPR_MAX_SIGNALS 40
 #endif
 
+#ifndef BIT_MPR_SIGNALFD
+    #define BIT_MPR_SIGNALFD    0           /**< Receive asynchronous signals via signalfd on Linux */
+#endif
+#if LINUX && BIT_MPR_SIGNALFD && defined(SFD_NONBLOCK)
+    #define MPR_SIGNALFD        1
+#else
+    #define MPR_SIGNALFD        0
+#endif
+
 /**
     Signal callback procedure
     @ingroup MprSignal
@@ -7912,6 +8910,11 @@ typedef struct MprSignalService {
 #if BIT_UNIX_LIKE
     struct sigaction prior[MPR_MAX_SIGNALS];/**< Prior sigaction handler before hooking */
 #endif
+#if MPR_SIGNALFD
+    int             fd;                     /**< Signalfd descriptor. Set to -1 if not used */
+    sigset_t        mask;                   /**< Signals blocked and received via the signalfd */
+    struct MprWaitHandler *handler;         /**< Wait handler for the signalfd */
+#endif
 } MprSignalService;
 
 
@@ -7919,6 +8922,7 @@ typedef struct MprSignalService {
     Internal
  */
 PUBLIC MprSignalService *mprCreateSignalService();
+PUBLIC int  mprStartSignalService();
 PUBLIC void mprStopSignalService();
 PUBLIC void mprRemoveSignalHandler(MprSignal *sp);
 PUBLIC void mprServiceSignals();
@@ -7966,6 +8970,8 @@ typedef void (*MprForkCallback)(void *arg);
 typedef struct MprCmdService {
     MprList         *cmds;              /* List of all commands. This is a static list and elements are not retained for GC */
     MprMutex        *mutex;             /* Multithread sync */
+    int             pidfd;              /* Process descriptors are supported (pidfd_open) */
+    int             spawn;              /* Commands may use posix_spawn. The process umask matches the vfork child */
 } MprCmdService;
 
 /*
@@ -8059,6 +9065,8 @@ typedef struct MprCmd {
     void            *callbackData;
     MprForkCallback forkCallback;       /**< Forked client callback */
     MprSignal       *signal;            /**< Signal handler for SIGCHLD */
+    int             pidfd;              /**< Process descriptor to detect exit. Set to -1 if not used */
+    MprWaitHandler  *exitHandler;       /**< Wait handler for the process descriptor */
     void            *forkData;
     MprBuf          *stdoutBuf;         /**< Standard output from the client */
     MprBuf          *stderrBuf;         /**< Standard error output from the client */
@@ -8334,6 +9342,9 @@ PUBLIC void mprSetCmdSearchPath(MprCmd *cmd, cchar *search);
 /**
     Start the command. This starts the command but does not wait for its completion. Once started, mprWriteCmd
     can be used to write to the command and response data can be received via mprReadCmd.
+    @description On Linux, if no custom forkCallback is defined, the command is created via posix_spawn. Otherwise
+        it is created via vfork and the callback is run in the child before exec. Spawned commands inherit the
+        process umask, so posix_spawn is only used if the umask was 022 when the MPR started, as set for vfork children.
     @param cmd MprCmd object created via mprCreateCmd
     @param argc Count of arguments in argv
     @param argv Command arguments array
@@ -8395,6 +9406,92 @@ PUBLIC ssize mprWriteCmd(MprCmd *cmd, int channel, char *buf, ssize bufsize);
  */
 PUBLIC ssize mprWriteCmdBlock(MprCmd *cmd, int channel, char *buf, ssize bufsize);
 
+/**
+    Pool of pre-started helper commands
+    @description A command pool keeps a set of helper processes running to service repeated requests without creating
+        a new process for each request. Helpers speak a simple framed protocol on stdin and stdout. Each request and 
+        response is a decimal length followed by a newline and then the data. Helpers that exit are restarted 
+        automatically. Requests that exceed the pool queue limit are rejected so callers can apply back-pressure.
+    @see mprCreateCmdPool mprDestroyCmdPool mprRunCmdPool mprSubmitCmdPool
+    @defgroup MprCmdPool MprCmdPool
+    @stability Prototype
+ */
+typedef struct MprCmdPool {
+    cchar           **argv;             /**< Helper command arguments */
+    int             argc;               /**< Count of helper arguments */
+    int             max;                /**< Number of helpers to run */
+    int             maxQueue;           /**< Maximum number of queued requests. Zero for no limit */
+    int             restarts;           /**< Count of helper restarts */
+    int             destroyed;          /**< Pool has been destroyed */
+    MprList         *helpers;           /**< Helper commands (MprCmd) */
+    MprList         *queue;             /**< Requests waiting for a helper */
+    MprDispatcher   *dispatcher;        /**< Dispatcher for helper I/O events and request callbacks */
+    MprMutex        *mutex;             /**< Multithread sync */
+} MprCmdPool;
+
+/**
+    Command pool callback. Invoked on the pool dispatcher when a request completes.
+    @param pool Command pool that ran the request
+    @param status Zero if the request completed. Otherwise a negative MPR error code.
+    @param response Response data from the helper. This is null terminated.
+    @param len Length of the response data
+    @param arg Argument supplied to mprSubmitCmdPool
+    @ingroup MprCmdPool
+    @stability Prototype
+ */
+typedef void (*MprCmdPoolProc)(MprCmdPool *pool, int status, cchar *response, ssize len, void *arg);
+
+/**
+    Create a command pool
+    @description Start a pool of helper commands that service framed requests on stdin and respond on stdout.
+    @param command Helper command line
+    @param count Number of helper processes to run
+    @param maxQueue Maximum number of requests that may wait for an available helper. Set to zero for no limit.
+    @param dispatcher Dispatcher to use for helper I/O events and request callbacks. Set to null to use the MPR dispatcher.
+    @return Command pool object or null if the helpers cannot be started.
+    @ingroup MprCmdPool
+    @stability Prototype
+ */
+PUBLIC MprCmdPool *mprCreateCmdPool(cchar *command, int count, int maxQueue, MprDispatcher *dispatcher);
+
+/**
+    Destroy a command pool
+    @description Stop the helper commands. Queued and running requests are completed with MPR_ERR_ABORTED.
+    @param pool Command pool created via mprCreateCmdPool
+    @ingroup MprCmdPool
+    @stability Prototype
+ */
+PUBLIC void mprDestroyCmdPool(MprCmdPool *pool);
+
+/**
+    Run a request on a command pool and wait for the response
+    @param pool Command pool created via mprCreateCmdPool
+    @param data Request data
+    @param len Length of the request data. Set to -1 if the data is null terminated.
+    @param response Set to the response data. The response is null terminated.
+    @param timeout Time in milliseconds to wait for the response. Set to -1 to wait forever.
+    @return Zero if successful. Returns MPR_ERR_BUSY if the pool queue is full and MPR_ERR_TIMEOUT if the response does
+        not arrive in time. Otherwise a negative MPR error code.
+    @ingroup MprCmdPool
+    @stability Prototype
+ */
+PUBLIC int mprRunCmdPool(MprCmdPool *pool, cchar *data, ssize len, char **response, MprTicks timeout);
+
+/**
+    Submit a request to a command pool
+    @description The request is written to the next available helper. The callback is invoked on the pool dispatcher
+        with the response. This routine is thread safe.
+    @param pool Command pool created via mprCreateCmdPool
+    @param data Request data
+    @param len Length of the request data. Set to -1 if the data is null terminated.
+    @param proc Callback to invoke when the request completes
+    @param arg Argument to pass to the callback
+    @return Zero if the request is queued. Returns MPR_ERR_BUSY if the pool queue is full.
+    @ingroup MprCmdPool
+    @stability Prototype
+ */
+PUBLIC int mprSubmitCmdPool(MprCmdPool *pool, cchar *data, ssize len, MprCmdPoolProc proc, void *arg);
+
 /********************************** Cache *************************************/
 
 #define MPR_CACHE_SHARED        0x1     /**< Use shared cache */
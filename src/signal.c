@@ -15,6 +15,10 @@ static void manageSignal(MprSignal *sp, int flags);
 static void manageSignalService(MprSignalService *ssp, int flags);
 static void signalEvent(MprSignal *sp, MprEvent *event);
 static void signalHandler(int signo, siginfo_t *info, void *arg);
+#if MPR_SIGNALFD
+static void defaultSignal(int signo);
+static void signalfdEvent(MprSignalService *ssp, MprEvent *event);
+#endif
 static void standardSignalHandler(void *ignored, MprSignal *sp);
 static void unhookSignal(int signo);
 
@@ -30,6 +34,28 @@ PUBLIC MprSignalService *mprCreateSignalService()
     ssp->mutex = mprCreateLock();
     ssp->signals = mprAllocZeroed(sizeof(MprSignal*) * MPR_MAX_SIGNALS);
     ssp->standard = mprCreateList(-1, 0);
+#if MPR_SIGNALFD
+    /*
+        Block the asynchronous signals and receive them via a signalfd instead. This is called before any MPR threads 
+        are created, so all threads inherit the mask. Synchronous signals (SIGPIPE, SIGSEGV) are thread directed
+        and continue to use the signal handler.
+     */
+    sigemptyset(&ssp->mask);
+    sigaddset(&ssp->mask, SIGHUP);
+    sigaddset(&ssp->mask, SIGINT);
+    sigaddset(&ssp->mask, SIGQUIT);
+    sigaddset(&ssp->mask, SIGTERM);
+    sigaddset(&ssp->mask, SIGUSR1);
+    sigaddset(&ssp->mask, SIGUSR2);
+    sigaddset(&ssp->mask, SIGALRM);
+    sigaddset(&ssp->mask, SIGCHLD);
+    sigaddset(&ssp->mask, SIGWINCH);
+    if ((ssp->fd = signalfd(-1, &ssp->mask, SFD_NONBLOCK | SFD_CLOEXEC)) < 0) {
+        sigemptyset(&ssp->mask);
+    } else {
+        pthread_sigmask(SIG_BLOCK, &ssp->mask, 0);
+    }
+#endif
     return ssp;
 }
 
@@ -41,7 +67,30 @@ static void manageSignalService(MprSignalService *ssp, int flags)
         mprMark(ssp->standard);
         mprMark(ssp->signals);
         /* Don't mark signals elements as it will prevent signal handlers being reclaimed */
+#if MPR_SIGNALFD
+        mprMark(ssp->handler);
+#endif
+    }
+}
+
+
+/*
+    Register the signalfd with the wait service. Called once the wait service is created.
+ */
+PUBLIC int mprStartSignalService()
+{
+#if MPR_SIGNALFD
+    MprSignalService    *ssp;
+
+    ssp = MPR->signalService;
+    if (ssp->fd >= 0) {
+        ssp->handler = mprCreateWaitHandler(ssp->fd, MPR_READABLE, NULL, signalfdEvent, ssp, MPR_WAIT_IMMEDIATE);
+        if (ssp->handler == 0) {
+            return MPR_ERR_CANT_INITIALIZE;
+        }
     }
+#endif
+    return 0;
 }
 
 
@@ -52,6 +101,20 @@ PUBLIC void mprStopSignalService()
     for (i = 1; i < MPR_MAX_SIGNALS; i++) {
         unhookSignal(i);
     }
+#if MPR_SIGNALFD
+{
+    MprSignalService    *ssp;
+
+    ssp = MPR->signalService;
+    if (ssp->fd >= 0) {
+        mprRemoveWaitHandler(ssp->handler);
+        ssp->handler = 0;
+        close(ssp->fd);
+        ssp->fd = -1;
+        pthread_sigmask(SIG_UNBLOCK, &ssp->mask, 0);
+    }
+}
+#endif
 }
 
 
@@ -167,6 +230,69 @@ PUBLIC void mprServiceSignals()
 }
 
 
+#if MPR_SIGNALFD
+/*
+    Read signals from the signalfd. This is an immediate wait handler invoked on the notifier thread, so signals are 
+    serviced without polling and without the async-safe restrictions of signal handlers. 
+ */
+static void signalfdEvent(MprSignalService *ssp, MprEvent *event)
+{
+    struct signalfd_siginfo info[8];
+    MprSignal               *sp;
+    ssize                   nbytes;
+    int                     i, signo;
+
+    while ((nbytes = read(ssp->fd, info, sizeof(info))) > 0) {
+        for (i = 0; i < (int) (nbytes / sizeof(struct signalfd_siginfo)); i++) {
+            signo = (int) info[i].ssi_signo;
+            if (signo <= 0 || signo >= MPR_MAX_SIGNALS) {
+                continue;
+            }
+            if ((sp = ssp->signals[signo]) != 0) {
+                mprCreateEvent(sp->dispatcher, "signalEvent", 0, signalEvent, sp, 0);
+            } else {
+                defaultSignal(signo);
+            }
+        }
+    }
+}
+
+
+/*
+    Emulate the action for a signal received via the signalfd that has no MPR handlers
+ */
+static void defaultSignal(int signo)
+{
+    struct sigaction    act;
+    sigset_t            set;
+
+    if (sigaction(signo, 0, &act) != 0 || act.sa_handler == SIG_IGN || act.sa_sigaction == signalHandler) {
+        return;
+    }
+    if (act.sa_handler != SIG_DFL) {
+        /* Foreign handler installed without using mprAddSignalHandler */
+        if (act.sa_flags & SA_SIGINFO) {
+            (act.sa_sigaction)(signo, NULL, NULL);
+        } else {
+            (act.sa_handler)(signo);
+        }
+        return;
+    }
+    if (signo == SIGCHLD || signo == SIGWINCH) {
+        /* Default action is to ignore */
+        return;
+    }
+    /*
+        Default action is to terminate. Deliver the signal to this thread with the default disposition.
+     */
+    sigemptyset(&set);
+    sigaddset(&set, signo);
+    pthread_sigmask(SIG_UNBLOCK, &set, 0);
+    raise(signo);
+}
+#endif
+
+
 /*
     Invoke the next signal handler. Runs from the dispatcher so signal handlers don't have to be async-safe.
  */
@@ -355,6 +481,7 @@ static void standardSignalHandler(void *ignored, MprSignal *sp)
 #else /* BIT_UNIX_LIKE */
     void mprAddStandardSignals() {}
     MprSignalService *mprCreateSignalService() { return mprAlloc(0); }
+    int mprStartSignalService() { return 0; }
     void mprStopSignalService() {};
     void mprRemoveSignalHandler(MprSignal *sp) { }
     void mprServiceSignals() {}
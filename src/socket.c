@@ -16,27 +16,111 @@
  */
 #define BIT_HAS_GETADDRINFO 1
 #endif
+#if LINUX && defined(SO_ZEROCOPY) && defined(MSG_ZEROCOPY) && defined(SO_EE_ORIGIN_ZEROCOPY)
+/*
+    Send large buffers without copying and collect completions from the socket error queue
+ */
+#define BIT_HAS_ZEROCOPY 1
+#endif
+#if LINUX && defined(SPLICE_F_NONBLOCK)
+#define BIT_HAS_SPLICE 1
+#endif
+#if LINUX && defined(TCP_CORK)
+/*
+    Hold partial segments while headers, file data and trailers are queued so small responses leave in one packet
+ */
+#define BIT_HAS_CORK 1
+#endif
+#if LINUX && defined(MSG_WAITFORONE)
+/*
+    Use recvmmsg and sendmmsg to move a batch of datagrams per system call
+ */
+#define BIT_HAS_MMSG 1
+#endif
 
 /********************************** Defines ***********************************/
 
 #ifndef BIT_MAX_IP
     #define BIT_MAX_IP 1024
 #endif
+#ifndef MSG_DONTWAIT
+    #define MSG_DONTWAIT 0
+#endif
+
+#define MPR_SOCKET_BATCH    64          /* Max datagrams per batch system call */
+#define MPR_ZEROCOPY_MIN    (16 * 1024) /* Smaller writes are cheaper to copy than to pin and notify */
+#define MPR_ZEROCOPY_REAP   10          /* Period in msec to reap zero-copy completions while sends are outstanding */
+#define MPR_SENDFILE_COPY   (8 * 1024)  /* Smaller file data is read and written with the headers in one system call */
+#define MPR_SENDFILE_VEC    16          /* Max header and trailer vectors for a combined write */
+
+/*
+    MSG_ZEROCOPY send awaiting completion
+ */
+typedef struct ZeroCopy {
+    uint            seq;
+    MprDispatcher   *dispatcher;
+    void            *proc;
+    void            *data;
+} ZeroCopy;
+
+/*
+    Cached host address. Resolution failures are cached with a negative status if a fail timeout is configured.
+ */
+typedef struct DnsEntry {
+    MprTicks                expires;
+    struct sockaddr_storage addr;
+    Socklen                 addrlen;
+    int                     family;
+    int                     protocol;
+    int                     status;
+    int                     refreshing;
+} DnsEntry;
+
+/*
+    Background resolution request
+ */
+typedef struct DnsRequest {
+    char            *ip;
+    DnsEntry        *entry;
+    MprDispatcher   *dispatcher;
+    void            *proc;
+    void            *data;
+} DnsRequest;
 
 /********************************** Forwards **********************************/
 
 static void closeSocket(MprSocket *sp, bool gracefully);
+static void completeZeroCopy(MprSocket *sp, uint lo, uint hi, int flags);
 static int connectSocket(MprSocket *sp, cchar *ipAddr, int port, int initialFlags);
 static MprSocketProvider *createStandardProvider(MprSocketService *ss);
 static void disconnectSocket(MprSocket *sp);
 static ssize flushSocket(MprSocket *sp);
+static Socket acceptFd(MprSocket *listen, struct sockaddr *addr, Socklen *addrlen);
 static int getSocketIpAddr(struct sockaddr *addr, int addrlen, char *ip, int size, int *port);
+static int getSocketAddrPort(struct sockaddr *addr);
+static int getDatagramAddr(MprSocket *sp);
+static void cacheEntry(MprSocketService *ss, cchar *ip, DnsEntry *dp);
+static int getAddrInfo(cchar *ip, int port, int *family, int *protocol, struct sockaddr_storage *addr, Socklen *addrlen);
+static int getDnsEntry(DnsEntry *dp, int port, int *family, int *protocol, struct sockaddr **addr, Socklen *addrlen);
 static int ipv6(cchar *ip);
+static void setBusyPoll(MprSocket *sp);
 static void manageSocket(MprSocket *sp, int flags);
+static void manageDnsRequest(DnsRequest *req, int flags);
 static void manageSocketService(MprSocketService *ss, int flags);
+static void manageZeroCopy(ZeroCopy *zp, int flags);
+static void pruneDnsCache(MprSocketService *ss);
 static void manageSsl(MprSsl *ssl, int flags);
 static ssize readSocket(MprSocket *sp, void *buf, ssize bufsize);
+static void reapZeroCopy(MprSocket *sp);
+static void reapZeroCopyTimer(MprSocket *sp, MprEvent *event);
+static int recvDatagrams(MprSocket *sp, MprIOVec *bufs, int count, int flags);
+static void resolveEntry(MprSocketService *ss, cchar *ip, DnsEntry *dp);
+static void resolveWorker(DnsRequest *req, MprWorker *worker);
+static int sendDatagrams(MprSocket *sp, MprIOVec *bufs, int count);
 static char *socketState(MprSocket *sp);
+static int startResolver(cchar *ip, MprDispatcher *dispatcher, void *proc, void *data);
+static ssize spliceCopy(MprSocket *sp, int fd, ssize len);
+static void steerByCpu(MprSocket *sp, int count);
 static ssize writeSocket(MprSocket *sp, cvoid *buf, ssize bufsize);
 
 /************************************ Code ************************************/
@@ -62,6 +146,10 @@ PUBLIC MprSocketService *mprCreateSocketService()
     if ((ss->mutex = mprCreateLock()) == 0) {
         return 0;
     }
+    ss->resolver = getAddrInfo;
+    ss->dnsTimeout = MPR_TIMEOUT_DNS;
+    ss->dnsFailTimeout = MPR_TIMEOUT_DNS_FAIL;
+    ss->dnsCache = mprCreateHash(0, 0);
     serverName[0] = '\0';
     domainName[0] = '\0';
     hostName[0] = '\0';
@@ -101,6 +189,7 @@ static void manageSocketService(MprSocketService *ss, int flags)
         mprMark(ss->sslProvider);
         mprMark(ss->mutex);
         mprMark(ss->secureSockets);
+        mprMark(ss->dnsCache);
     }
 }
 
@@ -137,7 +226,7 @@ PUBLIC void mprAddSocketProvider(cchar *name, MprSocketProvider *provider)
 
     ss = MPR->socketService;
 
-    if (ss->providers == 0 && (ss->providers = mprCreateHash(0, 0)) == 0) {
+    if (ss->providers == 0 && (ss->providers = mprCreateHash(0, MPR_HASH_READ_MOSTLY)) == 0) {
         return;
     }
     provider->name = sclone(name);
@@ -160,6 +249,26 @@ PUBLIC int mprSetMaxSocketAccept(int max)
 }
 
 
+PUBLIC void mprSetSocketBusyPoll(int usec)
+{
+    assert(usec >= 0);
+
+    MPR->socketService->busyPoll = usec;
+}
+
+
+static void setBusyPoll(MprSocket *sp)
+{
+#if defined(SO_BUSY_POLL)
+    int     usec;
+
+    if ((usec = MPR->socketService->busyPoll) > 0) {
+        setsockopt(sp->fd, SOL_SOCKET, SO_BUSY_POLL, (char*) &usec, sizeof(usec));
+    }
+#endif
+}
+
+
 PUBLIC MprSocket *mprCreateSocket()
 {
     MprSocketService    *ss;
@@ -171,6 +280,7 @@ PUBLIC MprSocket *mprCreateSocket()
     }
     sp->port = -1;
     sp->fd = INVALID_SOCKET;
+    sp->pipe[0] = sp->pipe[1] = -1;
 
     sp->provider = ss->standardProvider;
     sp->service = ss;
@@ -192,10 +302,13 @@ static void manageSocket(MprSocket *sp, int flags)
         mprMark(sp->sslSocket);
         mprMark(sp->ssl);
         mprMark(sp->mutex);
+        mprMark(sp->zeroCopy);
+        mprMark(sp->zeroCopyTimer);
 
     } else if (flags & MPR_MANAGE_FREE) {
-        if (sp->fd != INVALID_SOCKET) {
+        if (sp->fd != INVALID_SOCKET || sp->pipe[0] >= 0) {
             sp->mutex = 0;
+            sp->zeroCopy = 0;
             mprCloseSocket(sp, 1);
         }
     }
@@ -215,6 +328,8 @@ static void resetSocket(MprSocket *sp)
         sp->port = -1;
         sp->fd = INVALID_SOCKET;
         sp->ip = 0;
+        sp->acceptIp = 0;
+        sp->addrlen = 0;
     }
     assert(sp->provider);
 }
@@ -269,7 +384,7 @@ PUBLIC Socket mprListenOnSocket(MprSocket *sp, cchar *ip, int port, int flags)
     sp->fd = INVALID_SOCKET;
     sp->port = port;
     sp->flags = (flags & (MPR_SOCKET_BROADCAST | MPR_SOCKET_DATAGRAM | MPR_SOCKET_BLOCK |
-         MPR_SOCKET_NOREUSE | MPR_SOCKET_NODELAY | MPR_SOCKET_THREAD));
+         MPR_SOCKET_NOREUSE | MPR_SOCKET_NODELAY | MPR_SOCKET_THREAD | MPR_SOCKET_REUSEPORT));
     datagram = sp->flags & MPR_SOCKET_DATAGRAM;
 
     /*
@@ -282,6 +397,10 @@ PUBLIC Socket mprListenOnSocket(MprSocket *sp, cchar *ip, int port, int flags)
         unlock(sp);
         return SOCKET_ERROR;
     }
+    if (datagram) {
+        /* mprGetSocketInfo resolves a stream protocol. Use the default datagram protocol for the family. */
+        protocol = 0;
+    }
     if ((sp->fd = (int) socket(family, datagram ? SOCK_DGRAM: SOCK_STREAM, protocol)) == SOCKET_ERROR) {
         unlock(sp);
         assert(sp->fd == INVALID_SOCKET);
@@ -301,6 +420,14 @@ PUBLIC Socket mprListenOnSocket(MprSocket *sp, cchar *ip, int port, int flags)
         setsockopt(sp->fd, SOL_SOCKET, SO_REUSEADDR, (char*) &rc, sizeof(rc));
 #elif BIT_WIN_LIKE && defined(SO_EXCLUSIVEADDRUSE)
         setsockopt(sp->fd, SOL_SOCKET, SO_REUSEADDR | SO_EXCLUSIVEADDRUSE, (char*) &rc, sizeof(rc));
+#endif
+    }
+    if (sp->flags & MPR_SOCKET_REUSEPORT) {
+#if defined(SO_REUSEPORT)
+        rc = 1;
+        setsockopt(sp->fd, SOL_SOCKET, SO_REUSEPORT, (char*) &rc, sizeof(rc));
+#else
+        sp->flags &= ~MPR_SOCKET_REUSEPORT;
 #endif
     }
     /*
@@ -374,6 +501,66 @@ PUBLIC Socket mprListenOnSocket(MprSocket *sp, cchar *ip, int port, int flags)
 }
 
 
+/*
+    Open a set of listeners sharing one port via SO_REUSEPORT. The kernel hashes each new connection to one listener.
+ */
+PUBLIC MprList *mprListenOnSockets(cchar *ip, int port, int flags, int count)
+{
+    MprList     *listeners;
+    MprSocket   *sp;
+    int         next;
+
+    assert(port > 0);
+#if defined(SO_REUSEPORT)
+    if (count <= 0) {
+        count = MPR->heap->stats.numCpu;
+    }
+    count = max(count, 1);
+#else
+    count = 1;
+#endif
+    if ((listeners = mprCreateList(count, 0)) == 0) {
+        return 0;
+    }
+    for (next = 0; next < count; next++) {
+        if ((sp = mprCreateSocket()) == 0 || mprListenOnSocket(sp, ip, port, flags | MPR_SOCKET_REUSEPORT) == SOCKET_ERROR) {
+            for (next = 0; (sp = mprGetItem(listeners, next)) != 0; next++) {
+                mprCloseSocket(sp, 0);
+            }
+            return 0;
+        }
+        mprAddItem(listeners, sp);
+    }
+    if ((flags & MPR_SOCKET_REUSEPORT_CPU) && count > 1) {
+        steerByCpu(mprGetFirstItem(listeners), count);
+    }
+    return listeners;
+}
+
+
+/*
+    Attach a classic BPF program to the reuseport group that selects listener (cpu % count). The program is shared
+    by all members of the group. If unsupported, the kernel keeps hashing connections over the group.
+ */
+static void steerByCpu(MprSocket *sp, int count)
+{
+#if defined(SO_ATTACH_REUSEPORT_CBPF)
+    struct sock_filter  code[] = {
+        { BPF_LD | BPF_W | BPF_ABS, 0, 0, SKF_AD_OFF + SKF_AD_CPU },
+        { BPF_ALU | BPF_MOD | BPF_K, 0, 0, (uint) count },
+        { BPF_RET | BPF_A, 0, 0, 0 },
+    };
+    struct sock_fprog   prog;
+
+    prog.len = sizeof(code) / sizeof(code[0]);
+    prog.filter = code;
+    if (setsockopt(sp->fd, SOL_SOCKET, SO_ATTACH_REUSEPORT_CBPF, &prog, sizeof(prog)) < 0) {
+        mprLog(3, "Cannot attach reuseport CPU steering program, errno %d", mprGetOsError());
+    }
+#endif
+}
+
+
 PUBLIC MprWaitHandler *mprAddSocketHandler(MprSocket *sp, int mask, MprDispatcher *dispatcher, void *proc, 
     void *data, int flags)
 {
@@ -493,16 +680,25 @@ static int connectSocket(MprSocket *sp, cchar *ip, int port, int initialFlags)
         unlock(sp);
         return MPR_ERR_CANT_ACCESS;
     }
+    if (datagram) {
+        protocol = 0;
+    }
     if ((sp->fd = (int) socket(family, datagram ? SOCK_DGRAM: SOCK_STREAM, protocol)) < 0) {
         unlock(sp);
         return MPR_ERR_CANT_OPEN;
     }
+    if (datagram) {
+        /* Resolve once here rather than on every write */
+        memcpy(&sp->addr, addr, addrlen);
+        sp->addrlen = addrlen;
+    }
 #if !BIT_WIN_LIKE && !VXWORKS
     /*
         Children should not inherit this fd
      */
     fcntl(sp->fd, F_SETFD, FD_CLOEXEC);
 #endif
+    setBusyPoll(sp);
     if (broadcast) {
         int flag = 1;
         if (setsockopt(sp->fd, SOL_SOCKET, SO_BROADCAST, (char *) &flag, sizeof(flag)) < 0) {
@@ -656,9 +852,29 @@ static void closeSocket(MprSocket *sp, bool gracefully)
                 } while (mprGetTime() < timesUp);
             }
         }
+        if (sp->zeroCopy) {
+            reapZeroCopy(sp);
+        }
         closesocket(sp->fd);
         sp->fd = INVALID_SOCKET;
     }
+    if (sp->pipe[0] >= 0) {
+        close(sp->pipe[0]);
+        close(sp->pipe[1]);
+        sp->pipe[0] = sp->pipe[1] = -1;
+        sp->pipeLen = 0;
+    }
+    if (sp->zeroCopy) {
+        /*
+            The kernel may still reference the pages of sends it has not reported. Their completions can no longer be
+            read, so report them as aborted.
+         */
+        completeZeroCopy(sp, 0, MAXUINT, MPR_EVENT_ABORTED);
+    }
+    if (sp->zeroCopyTimer) {
+        mprRemoveEvent(sp->zeroCopyTimer);
+        sp->zeroCopyTimer = 0;
+    }
 
     if (sp->flags & MPR_SOCKET_SERVER) {
         lock(ss);
@@ -671,86 +887,186 @@ static void closeSocket(MprSocket *sp, bool gracefully)
 }
 
 
+/*
+    Accept a single connection. Unlike mprAcceptSockets, the remote and accepting addresses are formatted immediately
+    so sp->ip, sp->acceptIp and sp->acceptPort are set for callers that read them directly.
+ */
 PUBLIC MprSocket *mprAcceptSocket(MprSocket *listen)
+{
+    MprSocket   *sp;
+
+    if (mprAcceptSockets(listen, &sp, 1) != 1) {
+        return 0;
+    }
+    mprGetSocketIp(sp);
+    mprGetSocketAcceptIp(sp);
+    return sp;
+}
+
+
+/*
+    Accept pending connections until none remain or max have been accepted. The remote address is kept in raw form 
+    and only formatted if requested via mprGetSocketIp. Blocking listeners accept one connection.
+ */
+PUBLIC int mprAcceptSockets(MprSocket *listen, MprSocket **sockets, int max)
 {
     MprSocketService            *ss;
     MprSocket                   *nsp;
-    struct sockaddr_storage     addrStorage, saddrStorage;
-    struct sockaddr             *addr, *saddr;
-    char                        ip[BIT_MAX_IP], acceptIp[BIT_MAX_IP];
-    Socklen                     addrlen, saddrlen;
+    struct sockaddr_storage     addrStorage;
+    struct sockaddr             *addr;
+    Socklen                     addrlen;
     Socket                      fd;
-    int                         port, acceptPort;
+    int                         count, i, rejected;
 
     ss = MPR->socketService;
     addr = (struct sockaddr*) &addrStorage;
-    addrlen = sizeof(addrStorage);
-
-    if (listen->flags & MPR_SOCKET_BLOCK) {
-        mprYield(MPR_YIELD_STICKY);
-    }
-    fd = accept(listen->fd, addr, &addrlen);
     if (listen->flags & MPR_SOCKET_BLOCK) {
-        mprResetYield();
+        max = min(max, 1);
     }
-    if (fd == SOCKET_ERROR) {
-        if (mprGetError() != EAGAIN) {
-            mprTrace(6, "socket: accept failed, errno %d", mprGetOsError());
+    for (count = 0; count < max; ) {
+        addrlen = sizeof(addrStorage);
+        if ((fd = acceptFd(listen, addr, &addrlen)) == SOCKET_ERROR) {
+            break;
         }
-        return 0;
+        if ((nsp = mprCreateSocket()) == 0) {
+            closesocket(fd);
+            break;
+        }
+        nsp->fd = fd;
+        nsp->listenSock = listen;
+        nsp->flags = ((listen->flags & ~MPR_SOCKET_LISTENER) | MPR_SOCKET_SERVER);
+        nsp->acceptPort = listen->port;
+        memcpy(&nsp->addr, addr, addrlen);
+        nsp->addrlen = addrlen;
+        nsp->port = getSocketAddrPort(addr);
+        if (nsp->flags & MPR_SOCKET_NODELAY) {
+            mprSetSocketNoDelay(nsp, 1);
+        }
+        setBusyPoll(nsp);
+        sockets[count++] = nsp;
     }
-    if ((nsp = mprCreateSocket()) == 0) {
-        closesocket(fd);
+    if (count == 0) {
         return 0;
     }
-    nsp->fd = fd;
-    nsp->listenSock = listen;
-    nsp->port = listen->port;
-    nsp->flags = ((listen->flags & ~MPR_SOCKET_LISTENER) | MPR_SOCKET_SERVER);
-
     /*
         Limit the number of simultaneous clients
      */
     lock(ss);
-    if (++ss->numAccept >= ss->maxAccept) {
-        unlock(ss);
-        mprLog(2, "Rejecting connection, too many client connections (%d)", ss->numAccept);
-        mprCloseSocket(nsp, 0);
-        return 0;
+    for (i = rejected = 0; i < count; i++) {
+        nsp = sockets[i];
+        if (++ss->numAccept >= ss->maxAccept) {
+            mprLog(2, "Rejecting connection, too many client connections (%d)", ss->numAccept);
+            mprCloseSocket(nsp, 0);
+            rejected++;
+        } else {
+            sockets[i - rejected] = nsp;
+        }
     }
     unlock(ss);
+    return count - rejected;
+}
+
+
+/*
+    Accept a connection with close-on-exec and the blocking mode of the listener set. Returns SOCKET_ERROR if 
+    there are no more pending connections.
+ */
+static Socket acceptFd(MprSocket *listen, struct sockaddr *addr, Socklen *addrlen)
+{
+    Socket      fd;
 
+    if (listen->flags & MPR_SOCKET_BLOCK) {
+        mprYield(MPR_YIELD_STICKY);
+    }
+#if LINUX && defined(SOCK_CLOEXEC)
+    fd = accept4(listen->fd, addr, addrlen, SOCK_CLOEXEC | ((listen->flags & MPR_SOCKET_BLOCK) ? 0 : SOCK_NONBLOCK));
+#else
+    fd = accept(listen->fd, addr, addrlen);
+#endif
+    if (listen->flags & MPR_SOCKET_BLOCK) {
+        mprResetYield();
+    }
+    if (fd == SOCKET_ERROR) {
+        if (mprGetError() != EAGAIN) {
+            mprTrace(6, "socket: accept failed, errno %d", mprGetOsError());
+        }
+        return SOCKET_ERROR;
+    }
+#if !(LINUX && defined(SOCK_CLOEXEC))
 #if !BIT_WIN_LIKE && !VXWORKS
     /* Prevent children inheriting this socket */
     fcntl(fd, F_SETFD, FD_CLOEXEC);
 #endif
-
-    mprSetSocketBlockingMode(nsp, (nsp->flags & MPR_SOCKET_BLOCK) ? 1: 0);
-    if (nsp->flags & MPR_SOCKET_NODELAY) {
-        mprSetSocketNoDelay(nsp, 1);
+#if BIT_WIN_LIKE
+{
+    int flag = (listen->flags & MPR_SOCKET_BLOCK) ? 0 : 1;
+    ioctlsocket(fd, FIONBIO, (ulong*) &flag);
+}
+#elif VXWORKS
+{
+    int flag = (listen->flags & MPR_SOCKET_BLOCK) ? 0 : 1;
+    ioctl(fd, FIONBIO, (int) &flag);
+}
+#else
+    if (!(listen->flags & MPR_SOCKET_BLOCK)) {
+        fcntl(fd, F_SETFL, fcntl(fd, F_GETFL) | O_NONBLOCK);
     }
-    /*
-        Get the remote client address
-     */
-    if (getSocketIpAddr(addr, addrlen, ip, sizeof(ip), &port) != 0) {
-        assert(0);
-        mprCloseSocket(nsp, 0);
-        return 0;
+#endif
+#endif
+    return fd;
+}
+
+
+/*
+    Return the remote address of an accepted socket or the address given to mprListenOnSocket or mprConnectSocket.
+    Accepted socket addresses are formatted on first use.
+ */
+PUBLIC cchar *mprGetSocketIp(MprSocket *sp)
+{
+    struct sockaddr_storage     addrStorage;
+    char                        ip[BIT_MAX_IP];
+    int                         port;
+
+    if (sp->ip == 0 && sp->addrlen > 0) {
+        lock(sp);
+        if (sp->ip == 0) {
+            /* getSocketIpAddr may rewrite the address */
+            memcpy(&addrStorage, &sp->addr, sp->addrlen);
+            if (getSocketIpAddr((struct sockaddr*) &addrStorage, sp->addrlen, ip, sizeof(ip), &port) == 0) {
+                sp->ip = sclone(ip);
+            }
+        }
+        unlock(sp);
     }
-    nsp->ip = sclone(ip);
-    nsp->port = port;
+    return sp->ip;
+}
 
-    /*
-        Get the server interface address accepting the connection
-     */
-    saddr = (struct sockaddr*) &saddrStorage;
-    saddrlen = sizeof(saddrStorage);
-    getsockname(fd, saddr, &saddrlen);
-    acceptPort = 0;
-    getSocketIpAddr(saddr, saddrlen, acceptIp, sizeof(acceptIp), &acceptPort);
-    nsp->acceptIp = sclone(acceptIp);
-    nsp->acceptPort = acceptPort;
-    return nsp;
+
+/*
+    Return the server interface address that accepted the connection. This is determined on first use.
+ */
+PUBLIC cchar *mprGetSocketAcceptIp(MprSocket *sp)
+{
+    struct sockaddr_storage     addrStorage;
+    struct sockaddr             *addr;
+    Socklen                     addrlen;
+    char                        ip[BIT_MAX_IP];
+    int                         port;
+
+    if (sp->acceptIp == 0 && (sp->flags & MPR_SOCKET_SERVER)) {
+        lock(sp);
+        if (sp->acceptIp == 0 && sp->fd != INVALID_SOCKET) {
+            addr = (struct sockaddr*) &addrStorage;
+            addrlen = sizeof(addrStorage);
+            if (getsockname(sp->fd, addr, &addrlen) == 0 && 
+                    getSocketIpAddr(addr, addrlen, ip, sizeof(ip), &port) == 0) {
+                sp->acceptIp = sclone(ip);
+                sp->acceptPort = port;
+            }
+        }
+        unlock(sp);
+    }
+    return sp->acceptIp;
 }
 
 
@@ -791,6 +1107,9 @@ static ssize readSocket(MprSocket *sp, void *buf, ssize bufsize)
         unlock(sp);
         return -1;
     }
+    if (sp->zeroCopy) {
+        reapZeroCopy(sp);
+    }
 again:
     if (sp->flags & MPR_SOCKET_BLOCK) {
         mprYield(MPR_YIELD_STICKY);
@@ -854,10 +1173,8 @@ PUBLIC ssize mprWriteSocket(MprSocket *sp, cvoid *buf, ssize bufsize)
  */
 static ssize writeSocket(MprSocket *sp, cvoid *buf, ssize bufsize)
 {
-    struct sockaddr     *addr;
-    Socklen             addrlen;
     ssize               len, written, sofar;
-    int                 family, protocol, errCode;
+    int                 errCode;
 
     assert(buf);
     assert(bufsize >= 0);
@@ -865,11 +1182,14 @@ static ssize writeSocket(MprSocket *sp, cvoid *buf, ssize bufsize)
 
     lock(sp);
     if (sp->flags & (MPR_SOCKET_BROADCAST | MPR_SOCKET_DATAGRAM)) {
-        if (mprGetSocketInfo(sp->ip, sp->port, &family, &protocol, &addr, &addrlen) < 0) {
+        if (getDatagramAddr(sp) < 0) {
             unlock(sp);
             return MPR_ERR_CANT_FIND;
         }
     }
+    if (sp->zeroCopy) {
+        reapZeroCopy(sp);
+    }
     if (sp->flags & MPR_SOCKET_EOF) {
         sofar = MPR_ERR_CANT_WRITE;
     } else {
@@ -882,7 +1202,8 @@ static ssize writeSocket(MprSocket *sp, cvoid *buf, ssize bufsize)
                 mprYield(MPR_YIELD_STICKY);
             }
             if ((sp->flags & MPR_SOCKET_BROADCAST) || (sp->flags & MPR_SOCKET_DATAGRAM)) {
-                written = sendto(sp->fd, &((char*) buf)[sofar], (int) len, MSG_NOSIGNAL, addr, addrlen);
+                written = sendto(sp->fd, &((char*) buf)[sofar], (int) len, MSG_NOSIGNAL, (struct sockaddr*) &sp->addr, 
+                    sp->addrlen);
             } else {
                 written = send(sp->fd, &((char*) buf)[sofar], (int) len, MSG_NOSIGNAL);
             }
@@ -926,97 +1247,509 @@ static ssize writeSocket(MprSocket *sp, cvoid *buf, ssize bufsize)
 
 
 /*
-    Write a string to the socket
+    Return the datagram destination. This is resolved by connectSocket, otherwise on first use.
  */
-PUBLIC ssize mprWriteSocketString(MprSocket *sp, cchar *str)
+static int getDatagramAddr(MprSocket *sp)
 {
-    return mprWriteSocket(sp, str, slen(str));
+    struct sockaddr     *addr;
+    Socklen             addrlen;
+    int                 family, protocol;
+
+    if (sp->addrlen == 0) {
+        if (mprGetSocketInfo(sp->ip, sp->port, &family, &protocol, &addr, &addrlen) < 0) {
+            return MPR_ERR_CANT_FIND;
+        }
+        memcpy(&sp->addr, addr, addrlen);
+        sp->addrlen = addrlen;
+    }
+    return 0;
 }
 
 
-PUBLIC ssize mprWriteSocketVector(MprSocket *sp, MprIOVec *iovec, int count)
+/*
+    Read up to count datagrams. Only the first datagram may block.
+ */
+PUBLIC int mprReadSocketBatch(MprSocket *sp, MprIOVec *bufs, int count)
 {
-    char        *start;
-    ssize       total, len, written;
-    int         i;
+    int     errCode, nread, rc;
 
-#if BIT_UNIX_LIKE
-    if (sp->sslSocket == 0) {
-        return writev(sp->fd, (const struct iovec*) iovec, (int) count);
-    } else
-#endif
-    {
-        //  OPT - better to buffer and have fewer raw writes
-        if (count <= 0) {
-            return 0;
-        }
-        start = iovec[0].start;
-        len = (int) iovec[0].len;
-        assert(len > 0);
+    assert(sp);
+    assert(bufs);
 
-        for (total = i = 0; i < count; ) {
-            written = mprWriteSocket(sp, start, len);
-            if (written < 0) {
-                if (total > 0) {
-                    break;
-                }
-                return written;
-            } else if (written == 0) {
+    lock(sp);
+    if (!(sp->flags & MPR_SOCKET_DATAGRAM) || sp->fd == INVALID_SOCKET) {
+        unlock(sp);
+        return MPR_ERR_BAD_STATE;
+    }
+    nread = 0;
+    while (nread < count) {
+        if (sp->flags & MPR_SOCKET_BLOCK) {
+            mprYield(MPR_YIELD_STICKY);
+        }
+        rc = recvDatagrams(sp, &bufs[nread], min(count - nread, MPR_SOCKET_BATCH), nread ? MSG_DONTWAIT : 0);
+        errCode = mprGetSocketError(sp);
+        if (sp->flags & MPR_SOCKET_BLOCK) {
+            mprResetYield();
+        }
+        if (rc < 0) {
+            if (errCode == EINTR) {
+                continue;
+            } else if (errCode == EAGAIN || errCode == EWOULDBLOCK || nread > 0) {
                 break;
-            } else {
-                len -= written;
-                start += written;
-                total += written;
-                if (len <= 0) {
-                    i++;
-                    start = iovec[i].start;
-                    len = (int) iovec[i].len;
-                }
             }
+            unlock(sp);
+            return -errCode;
+        }
+        nread += rc;
+        if (rc < MPR_SOCKET_BATCH) {
+            break;
         }
-        return total;
     }
+    unlock(sp);
+    return nread;
 }
 
 
-#if !BIT_ROM
-#if !LINUX || __UCLIBC__
-static ssize localSendfile(MprSocket *sp, MprFile *file, MprOff offset, ssize len)
+static int recvDatagrams(MprSocket *sp, MprIOVec *bufs, int count, int flags)
 {
-    char    buf[BIT_MAX_BUFFER];
+#if BIT_HAS_MMSG
+    struct mmsghdr  msgs[MPR_SOCKET_BATCH];
+    struct iovec    iov[MPR_SOCKET_BATCH];
+    int             i, rc;
 
-    mprSeekFile(file, SEEK_SET, (int) offset);
-    len = min(len, sizeof(buf));
-    if ((len = mprReadFile(file, buf, len)) < 0) {
-        assert(0);
-        return MPR_ERR_CANT_READ;
+    memset(msgs, 0, count * sizeof(struct mmsghdr));
+    for (i = 0; i < count; i++) {
+        iov[i].iov_base = bufs[i].start;
+        iov[i].iov_len = bufs[i].len;
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
     }
-    return mprWriteSocket(sp, buf, len);
-}
+    if ((rc = recvmmsg(sp->fd, msgs, count, flags | MSG_WAITFORONE, NULL)) > 0) {
+        for (i = 0; i < rc; i++) {
+            bufs[i].len = msgs[i].msg_len;
+        }
+    }
+    return rc;
+#else
+    ssize   bytes;
+    int     i;
+
+    for (i = 0; i < count; i++) {
+        bytes = recvfrom(sp->fd, bufs[i].start, (int) bufs[i].len, i ? (flags | MSG_DONTWAIT) : flags, NULL, NULL);
+        if (bytes < 0) {
+            return i ? i : -1;
+        }
+        bufs[i].len = bytes;
+    }
+    return count;
 #endif
+}
 
 
 /*
-    Write data from a file to a socket. Includes the ability to write header before and after the file data.
-    Works even with a null "file" to just output the headers.
+    Send each buffer as a datagram to the cached destination
  */
-PUBLIC MprOff mprSendFileToSocket(MprSocket *sock, MprFile *file, MprOff offset, MprOff bytes, MprIOVec *beforeVec, 
-    int beforeCount, MprIOVec *afterVec, int afterCount)
+PUBLIC int mprWriteSocketBatch(MprSocket *sp, MprIOVec *bufs, int count)
 {
-#if MACOSX && __MAC_OS_X_VERSION_MIN_REQUIRED >= 1050
-    struct sf_hdtr  def;
-#endif
-    MprOff          written, toWriteFile;
-    ssize           i, rc, toWriteBefore, toWriteAfter, nbytes;
-    int             done;
+    int     errCode, rc, sent;
 
-    rc = 0;
-
-#if MACOSX && __MAC_OS_X_VERSION_MIN_REQUIRED >= 1050
-    def.hdr_cnt = (int) beforeCount;
-    def.headers = (beforeCount > 0) ? (struct iovec*) beforeVec: 0;
-    def.trl_cnt = (int) afterCount;
-    def.trailers = (afterCount > 0) ? (struct iovec*) afterVec: 0;
+    assert(sp);
+    assert(bufs);
+
+    lock(sp);
+    if (!(sp->flags & (MPR_SOCKET_BROADCAST | MPR_SOCKET_DATAGRAM)) || sp->fd == INVALID_SOCKET) {
+        unlock(sp);
+        return MPR_ERR_BAD_STATE;
+    }
+    if (getDatagramAddr(sp) < 0) {
+        unlock(sp);
+        return MPR_ERR_CANT_FIND;
+    }
+    sent = 0;
+    while (sent < count) {
+        if (sp->flags & MPR_SOCKET_BLOCK) {
+            mprYield(MPR_YIELD_STICKY);
+        }
+        rc = sendDatagrams(sp, &bufs[sent], min(count - sent, MPR_SOCKET_BATCH));
+        errCode = mprGetSocketError(sp);
+        if (sp->flags & MPR_SOCKET_BLOCK) {
+            mprResetYield();
+        }
+        if (rc < 0) {
+            if (errCode == EINTR) {
+                continue;
+            } else if (errCode == EAGAIN || errCode == EWOULDBLOCK || sent > 0) {
+                break;
+            }
+            unlock(sp);
+            return -errCode;
+        }
+        sent += rc;
+        if (rc == 0) {
+            break;
+        }
+    }
+    unlock(sp);
+    return sent;
+}
+
+
+static int sendDatagrams(MprSocket *sp, MprIOVec *bufs, int count)
+{
+#if BIT_HAS_MMSG
+    struct mmsghdr  msgs[MPR_SOCKET_BATCH];
+    struct iovec    iov[MPR_SOCKET_BATCH];
+    int             i;
+
+    memset(msgs, 0, count * sizeof(struct mmsghdr));
+    for (i = 0; i < count; i++) {
+        iov[i].iov_base = bufs[i].start;
+        iov[i].iov_len = bufs[i].len;
+        msgs[i].msg_hdr.msg_name = &sp->addr;
+        msgs[i].msg_hdr.msg_namelen = sp->addrlen;
+        msgs[i].msg_hdr.msg_iov = &iov[i];
+        msgs[i].msg_hdr.msg_iovlen = 1;
+    }
+    return sendmmsg(sp->fd, msgs, count, MSG_NOSIGNAL);
+#else
+    int     i;
+
+    for (i = 0; i < count; i++) {
+        if (sendto(sp->fd, bufs[i].start, (int) bufs[i].len, MSG_NOSIGNAL, (struct sockaddr*) &sp->addr, 
+                sp->addrlen) < 0) {
+            return i ? i : -1;
+        }
+    }
+    return count;
+#endif
+}
+
+
+/*
+    Send with MSG_ZEROCOPY. The send is recorded with its sequence number so the completion can be matched when the
+    kernel reports it on the error queue. While sends are outstanding, a timer reaps completions so callbacks run
+    even if the socket is not read or written again.
+ */
+PUBLIC ssize mprWriteSocketZeroCopy(MprSocket *sp, cvoid *buf, ssize len, void *proc, void *data)
+{
+    MprDispatcher   *dispatcher;
+    ssize           written;
+
+    assert(sp);
+    assert(buf);
+    assert(len > 0);
+
+#if BIT_HAS_ZEROCOPY
+    {
+        ZeroCopy    *zp;
+        Socket      fd;
+        int         errCode, on;
+
+        lock(sp);
+        if (len >= MPR_ZEROCOPY_MIN && sp->provider == sp->service->standardProvider && sp->fd != INVALID_SOCKET &&
+                !(sp->flags & (MPR_SOCKET_BROADCAST | MPR_SOCKET_DATAGRAM | MPR_SOCKET_EOF))) {
+            if (!(sp->flags & MPR_SOCKET_ZEROCOPY)) {
+                on = 1;
+                if (setsockopt(sp->fd, SOL_SOCKET, SO_ZEROCOPY, (char*) &on, sizeof(on)) == 0) {
+                    sp->flags |= MPR_SOCKET_ZEROCOPY;
+                    if (!sp->zeroCopy) {
+                        sp->zeroCopy = mprCreateList(0, 0);
+                    }
+                }
+            }
+            if (sp->flags & MPR_SOCKET_ZEROCOPY) {
+                reapZeroCopy(sp);
+                fd = sp->fd;
+                unlock(sp);
+                if (sp->flags & MPR_SOCKET_BLOCK) {
+                    mprYield(MPR_YIELD_STICKY);
+                }
+                do {
+                    written = send(fd, buf, len, MSG_NOSIGNAL | MSG_ZEROCOPY);
+                    errCode = (written < 0) ? mprGetSocketError(sp) : 0;
+                } while (written < 0 && errCode == EINTR);
+                if (sp->flags & MPR_SOCKET_BLOCK) {
+                    mprResetYield();
+                }
+                if (written > 0) {
+                    lock(sp);
+                    /* The kernel numbers every successful send, so count it even if the socket was closed meanwhile */
+                    if ((zp = mprAllocObj(ZeroCopy, manageZeroCopy)) != 0) {
+                        zp->seq = sp->zeroCopySeq;
+                        zp->dispatcher = sp->handler ? sp->handler->dispatcher : 0;
+                        zp->proc = proc;
+                        zp->data = data;
+                        if (sp->fd == INVALID_SOCKET) {
+                            if (proc) {
+                                mprCreateEvent(zp->dispatcher, "zerocopy", 0, proc, data, MPR_EVENT_ABORTED);
+                            }
+                        } else {
+                            mprAddItem(sp->zeroCopy, zp);
+                            if (!sp->zeroCopyTimer) {
+                                sp->zeroCopyTimer = mprCreateTimerEvent(NULL, "zerocopy", MPR_ZEROCOPY_REAP,
+                                    reapZeroCopyTimer, sp, MPR_EVENT_QUICK);
+                            }
+                        }
+                    }
+                    sp->zeroCopySeq++;
+                    unlock(sp);
+                    return written;
+
+                } else if (errCode == EAGAIN || errCode == EWOULDBLOCK) {
+                    return 0;
+
+                } else if (errCode != ENOBUFS) {
+                    /* ENOBUFS means the socket option memory limit is reached. Copy instead. */
+                    return -errCode;
+                }
+                lock(sp);
+            }
+        }
+        unlock(sp);
+    }
+#endif
+    if ((written = mprWriteSocket(sp, buf, len)) > 0 && proc) {
+        dispatcher = sp->handler ? sp->handler->dispatcher : 0;
+        mprCreateEvent(dispatcher, "zerocopy", 0, proc, (void*) data, 0);
+    }
+    if (written == -EAGAIN || written == -EWOULDBLOCK) {
+        written = 0;
+    }
+    return written;
+}
+
+
+/*
+    Read MSG_ZEROCOPY completion notifications from the error queue. Each notification covers a range of sends.
+    Must be called locked.
+ */
+static void reapZeroCopy(MprSocket *sp)
+{
+#if BIT_HAS_ZEROCOPY
+    struct sock_extended_err    *ee;
+    struct cmsghdr              *cm;
+    struct msghdr               msg;
+    char                        control[128];
+
+    while (mprGetListLength(sp->zeroCopy) > 0 && sp->fd != INVALID_SOCKET) {
+        memset(&msg, 0, sizeof(msg));
+        msg.msg_control = control;
+        msg.msg_controllen = sizeof(control);
+        if (recvmsg(sp->fd, &msg, MSG_ERRQUEUE | MSG_DONTWAIT) < 0) {
+            break;
+        }
+        for (cm = CMSG_FIRSTHDR(&msg); cm; cm = CMSG_NXTHDR(&msg, cm)) {
+            ee = (struct sock_extended_err*) CMSG_DATA(cm);
+            if (ee->ee_errno == 0 && ee->ee_origin == SO_EE_ORIGIN_ZEROCOPY) {
+                completeZeroCopy(sp, ee->ee_info, ee->ee_data, 0);
+            }
+        }
+    }
+#endif
+}
+
+
+/*
+    Reap completions while zero-copy sends are outstanding. The timer is removed once all have completed.
+ */
+static void reapZeroCopyTimer(MprSocket *sp, MprEvent *event)
+{
+    lock(sp);
+    reapZeroCopy(sp);
+    if (mprGetListLength(sp->zeroCopy) == 0 && sp->zeroCopyTimer == event) {
+        mprRemoveEvent(event);
+        sp->zeroCopyTimer = 0;
+    }
+    unlock(sp);
+}
+
+
+/*
+    Queue completion events for sends with sequence numbers in the range lo to hi inclusive. Sequences may wrap.
+    Set flags to MPR_EVENT_ABORTED if the kernel will not report the completion. Must be called locked.
+ */
+static void completeZeroCopy(MprSocket *sp, uint lo, uint hi, int flags)
+{
+    ZeroCopy    *zp;
+    int         next;
+
+    for (next = 0; (zp = mprGetNextItem(sp->zeroCopy, &next)) != 0; ) {
+        if ((uint) (zp->seq - lo) <= (uint) (hi - lo)) {
+            mprRemoveItemAtPos(sp->zeroCopy, --next);
+            if (zp->proc) {
+                mprCreateEvent(zp->dispatcher, "zerocopy", 0, zp->proc, zp->data, flags);
+            }
+        }
+    }
+}
+
+
+static void manageZeroCopy(ZeroCopy *zp, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(zp->dispatcher);
+        mprMark(zp->data);
+    }
+}
+
+
+/*
+    Write a string to the socket
+ */
+PUBLIC ssize mprWriteSocketString(MprSocket *sp, cchar *str)
+{
+    return mprWriteSocket(sp, str, slen(str));
+}
+
+
+PUBLIC ssize mprWriteSocketVector(MprSocket *sp, MprIOVec *iovec, int count)
+{
+    char        *start;
+    ssize       total, len, written;
+    int         i;
+
+#if BIT_UNIX_LIKE
+    if (sp->sslSocket == 0) {
+        return writev(sp->fd, (const struct iovec*) iovec, (int) count);
+    } else
+#endif
+    {
+        //  OPT - better to buffer and have fewer raw writes
+        if (count <= 0) {
+            return 0;
+        }
+        start = iovec[0].start;
+        len = (int) iovec[0].len;
+        assert(len > 0);
+
+        for (total = i = 0; i < count; ) {
+            written = mprWriteSocket(sp, start, len);
+            if (written < 0) {
+                if (total > 0) {
+                    break;
+                }
+                return written;
+            } else if (written == 0) {
+                break;
+            } else {
+                len -= written;
+                start += written;
+                total += written;
+                if (len <= 0) {
+                    i++;
+                    start = iovec[i].start;
+                    len = (int) iovec[i].len;
+                }
+            }
+        }
+        return total;
+    }
+}
+
+
+#if !BIT_ROM
+#if !LINUX || __UCLIBC__
+static ssize localSendfile(MprSocket *sp, MprFile *file, MprOff offset, ssize len)
+{
+    char    buf[BIT_MAX_BUFFER];
+
+    mprSeekFile(file, SEEK_SET, (int) offset);
+    len = min(len, sizeof(buf));
+    if ((len = mprReadFile(file, buf, len)) < 0) {
+        assert(0);
+        return MPR_ERR_CANT_READ;
+    }
+    return mprWriteSocket(sp, buf, len);
+}
+#endif
+
+
+#if BIT_UNIX_LIKE
+/*
+    Send a small file portion with its headers and trailers in one write. Reading the file is cheaper than the extra
+    system calls and packets of separate header, sendfile and trailer writes. As with sendfile, if the file is shorter
+    than expected, the headers and the available file data are written without the trailers.
+ */
+static MprOff sendSmallFile(MprSocket *sp, MprFile *file, MprOff offset, ssize len, MprIOVec *beforeVec, int beforeCount,
+    MprIOVec *afterVec, int afterCount)
+{
+    MprIOVec    iovec[MPR_SENDFILE_VEC];
+    char        buf[MPR_SENDFILE_COPY];
+    ssize       nread, rc;
+    int         count, errCode, i;
+
+    if (sp->flags & MPR_SOCKET_EOF) {
+        return MPR_ERR_CANT_WRITE;
+    }
+    do {
+        nread = pread(file->fd, buf, len, (off_t) offset);
+    } while (nread < 0 && errno == EINTR);
+    if (nread < 0) {
+        return -1;
+    }
+    count = 0;
+    for (i = 0; i < beforeCount; i++) {
+        iovec[count++] = beforeVec[i];
+    }
+    iovec[count].start = buf;
+    iovec[count++].len = nread;
+    if (nread == len) {
+        for (i = 0; i < afterCount; i++) {
+            iovec[count++] = afterVec[i];
+        }
+    }
+    do {
+        if (sp->flags & MPR_SOCKET_BLOCK) {
+            mprYield(MPR_YIELD_STICKY);
+        }
+        rc = writev(sp->fd, (const struct iovec*) iovec, count);
+        /* Get the error code before calling mprResetYield to avoid clearing global error numbers */
+        errCode = (rc < 0) ? mprGetSocketError(sp) : 0;
+        if (sp->flags & MPR_SOCKET_BLOCK) {
+            mprResetYield();
+        }
+    } while (rc < 0 && errCode == EINTR);
+
+    if (rc < 0) {
+        return (errCode == EAGAIN || errCode == EWOULDBLOCK) ? 0 : -1;
+    }
+    return rc;
+}
+#endif
+
+
+#if BIT_HAS_CORK
+static void setCork(MprSocket *sp, int on)
+{
+    setsockopt(sp->fd, IPPROTO_TCP, TCP_CORK, (char*) &on, sizeof(on));
+}
+#endif
+
+
+/*
+    Write data from a file to a socket. Includes the ability to write header before and after the file data.
+    Works even with a null "file" to just output the headers.
+ */
+PUBLIC MprOff mprSendFileToSocket(MprSocket *sock, MprFile *file, MprOff offset, MprOff bytes, MprIOVec *beforeVec, 
+    int beforeCount, MprIOVec *afterVec, int afterCount)
+{
+#if MACOSX && __MAC_OS_X_VERSION_MIN_REQUIRED >= 1050
+    struct sf_hdtr  def;
+#endif
+    MprOff          written, toWriteFile;
+    ssize           i, rc, toWriteBefore, toWriteAfter, nbytes;
+    int             done;
+#if BIT_HAS_CORK
+    int             cork, errCode;
+#endif
+
+    rc = 0;
+
+#if MACOSX && __MAC_OS_X_VERSION_MIN_REQUIRED >= 1050
+    def.hdr_cnt = (int) beforeCount;
+    def.headers = (beforeCount > 0) ? (struct iovec*) beforeVec: 0;
+    def.trl_cnt = (int) afterCount;
+    def.trailers = (afterCount > 0) ? (struct iovec*) afterVec: 0;
 
     if (file && file->fd >= 0) {
         written = bytes;
@@ -1044,6 +1777,21 @@ PUBLIC MprOff mprSendFileToSocket(MprSocket *sock, MprFile *file, MprOff offset,
         toWriteFile = (bytes - toWriteBefore - toWriteAfter);
         assert(toWriteFile >= 0);
 
+#if BIT_UNIX_LIKE
+        if (toWriteFile > 0 && toWriteFile <= MPR_SENDFILE_COPY && file && file->fd >= 0 && sock->sslSocket == 0 &&
+                (beforeCount + afterCount) > 0 && (beforeCount + afterCount) < MPR_SENDFILE_VEC) {
+            return sendSmallFile(sock, file, offset, (ssize) toWriteFile, beforeVec, beforeCount, afterVec, afterCount);
+        }
+#endif
+#if BIT_HAS_CORK
+        /*
+            Cork so the headers are not pushed as a separate packet ahead of the file data
+         */
+        cork = (toWriteFile > 0 && (beforeCount > 0 || afterCount > 0) && sock->sslSocket == 0);
+        if (cork) {
+            setCork(sock, 1);
+        }
+#endif
         /*
             Linux sendfile does not have the integrated ability to send headers. Must do it separately here.
             I/O requests may return short (write fewer than requested bytes).
@@ -1095,6 +1843,13 @@ PUBLIC MprOff mprSendFileToSocket(MprSocket *sock, MprFile *file, MprOff offset,
                 written += rc;
             }
         }
+#if BIT_HAS_CORK
+        if (cork) {
+            errCode = errno;
+            setCork(sock, 0);
+            errno = errCode;
+        }
+#endif
     }
     if (rc < 0) {
         if (errno == EAGAIN || errno == EWOULDBLOCK) {
@@ -1107,6 +1862,112 @@ PUBLIC MprOff mprSendFileToSocket(MprSocket *sock, MprFile *file, MprOff offset,
 #endif /* !BIT_ROM */
 
 
+/*
+    Forward pipe data to the socket. Splice moves pipe pages into the socket without a user space copy. For tee, the
+    data is first duplicated into a private pipe which is then spliced to the socket.
+ */
+PUBLIC ssize mprSpliceToSocket(MprSocket *sp, int fd, ssize len, int flags)
+{
+    ssize   rc, sent;
+    int     errCode;
+
+    assert(sp);
+    assert(fd >= 0);
+
+    if (len <= 0) {
+        return 0;
+    }
+    if (sp->provider != sp->service->standardProvider) {
+        return (flags & MPR_SPLICE_TEE) ? MPR_ERR_BAD_STATE : spliceCopy(sp, fd, len);
+    }
+#if BIT_HAS_SPLICE
+    lock(sp);
+    if (sp->fd == INVALID_SOCKET || (sp->flags & MPR_SOCKET_EOF)) {
+        unlock(sp);
+        return MPR_ERR_CANT_WRITE;
+    }
+    if (flags & MPR_SPLICE_TEE) {
+        if (sp->pipe[0] < 0 && pipe2(sp->pipe, O_CLOEXEC | O_NONBLOCK) < 0) {
+            unlock(sp);
+            return MPR_ERR_CANT_OPEN;
+        }
+        /*
+            Flush data duplicated by a prior call before taking more from the source pipe
+         */
+        while (sp->pipeLen > 0) {
+            if ((rc = splice(sp->pipe[0], NULL, sp->fd, NULL, sp->pipeLen, SPLICE_F_MOVE | SPLICE_F_NONBLOCK)) < 0) {
+                errCode = errno;
+                unlock(sp);
+                return (errCode == EAGAIN || errCode == EINTR) ? 0 : -errCode;
+            }
+            sp->pipeLen -= rc;
+        }
+        if ((rc = tee(fd, sp->pipe[1], len, SPLICE_F_NONBLOCK)) <= 0) {
+            errCode = errno;
+            unlock(sp);
+            if (rc == 0) {
+                return -1;
+            }
+            return (errCode == EAGAIN || errCode == EINTR) ? 0 : -errCode;
+        }
+        /* The duplicated data is committed to the socket. Any remainder is sent by the next call. */
+        sp->pipeLen = rc;
+        if ((sent = splice(sp->pipe[0], NULL, sp->fd, NULL, sp->pipeLen, SPLICE_F_MOVE | SPLICE_F_NONBLOCK)) > 0) {
+            sp->pipeLen -= sent;
+        }
+        unlock(sp);
+        return rc;
+    }
+    if (sp->flags & MPR_SOCKET_BLOCK) {
+        mprYield(MPR_YIELD_STICKY);
+    }
+    do {
+        rc = splice(fd, NULL, sp->fd, NULL, len, SPLICE_F_MOVE | SPLICE_F_NONBLOCK | SPLICE_F_MORE);
+    } while (rc < 0 && errno == EINTR);
+    errCode = errno;
+    if (sp->flags & MPR_SOCKET_BLOCK) {
+        mprResetYield();
+    }
+    unlock(sp);
+    if (rc < 0) {
+        return (errCode == EAGAIN) ? 0 : -errCode;
+    }
+    return (rc == 0) ? -1 : rc;
+#else
+    return (flags & MPR_SPLICE_TEE) ? MPR_ERR_BAD_STATE : spliceCopy(sp, fd, len);
+#endif
+}
+
+
+/*
+    Forward by reading and writing. Data read from the pipe is always written in full, waiting if required.
+ */
+static ssize spliceCopy(MprSocket *sp, int fd, ssize len)
+{
+    char    buf[BIT_MAX_BUFFER];
+    ssize   nbytes, rc, sofar;
+
+    if ((nbytes = read(fd, buf, (int) min(len, (ssize) sizeof(buf)))) < 0) {
+        return (errno == EAGAIN || errno == EINTR) ? 0 : MPR_ERR_CANT_READ;
+    } else if (nbytes == 0) {
+        return -1;
+    }
+    for (sofar = 0; sofar < nbytes; ) {
+        if ((rc = mprWriteSocket(sp, &buf[sofar], nbytes - sofar)) < 0) {
+            if (rc != -EAGAIN && rc != -EWOULDBLOCK) {
+                return rc;
+            }
+            if (mprWaitForSingleIO((int) sp->fd, MPR_WRITABLE, MPR_TIMEOUT_STOP) == 0) {
+                return MPR_ERR_TIMEOUT;
+            }
+        } else {
+            sofar += rc;
+        }
+    }
+    return nbytes;
+}
+
+
 static ssize flushSocket(MprSocket *sp)
 {
     return 0;
@@ -1322,22 +2183,241 @@ PUBLIC int mprGetSocketError(MprSocket *sp)
 }
 
 
-#if BIT_HAS_GETADDRINFO
 /*
-    Get a socket address from a host/port combination. If a host provides both IPv4 and IPv6 addresses, 
-    prefer the IPv4 address.
+    Get a socket address from a host/port combination. Addresses are cached by host name. An expired address is
+    returned while a worker refreshes it so that callers only block on the first resolution of a host.
  */
-PUBLIC int mprGetSocketInfo(cchar *ip, int port, int *family, int *protocol, struct sockaddr **addr, socklen_t *addrlen)
+PUBLIC int mprGetSocketInfo(cchar *ip, int port, int *family, int *protocol, struct sockaddr **addr, Socklen *addrlen)
 {
     MprSocketService    *ss;
-    struct addrinfo     hints, *res, *r;
-    char                *portStr;
-    int                 v6;
+    DnsEntry            *dp;
 
     assert(addr);
     ss = MPR->socketService;
+    if (ip == 0) {
+        ip = "";
+    }
+    if (ss->dnsTimeout > 0) {
+        lock(ss);
+        if ((dp = mprLookupKey(ss->dnsCache, ip)) != 0 && dp->expires <= mprGetTicks()) {
+            if (dp->status < 0) {
+                dp = 0;
+            } else if (!dp->refreshing) {
+                dp->refreshing = startResolver(ip, 0, 0, 0) == 0;
+            }
+        }
+        unlock(ss);
+        if (dp) {
+            return getDnsEntry(dp, port, family, protocol, addr, addrlen);
+        }
+    }
+    if ((dp = mprAllocObj(DnsEntry, 0)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    resolveEntry(ss, ip, dp);
+    cacheEntry(ss, ip, dp);
+    return getDnsEntry(dp, port, family, protocol, addr, addrlen);
+}
 
+
+PUBLIC int mprResolveSocketInfo(cchar *ip, MprDispatcher *dispatcher, void *proc, void *data)
+{
+    MprSocketService    *ss;
+    DnsEntry            *dp;
+    int                 rc;
+
+    ss = MPR->socketService;
+    if (ip == 0) {
+        ip = "";
+    }
     lock(ss);
+    dp = (ss->dnsTimeout > 0) ? mprLookupKey(ss->dnsCache, ip) : 0;
+    if (ss->dnsTimeout <= 0 || (dp && dp->expires > mprGetTicks())) {
+        unlock(ss);
+        if (proc) {
+            mprCreateEvent(dispatcher, "resolved", 0, proc, data, 0);
+        }
+        return 0;
+    }
+    if ((rc = startResolver(ip, dispatcher, proc, data)) == 0 && dp) {
+        dp->refreshing = 1;
+    }
+    unlock(ss);
+    return rc;
+}
+
+
+PUBLIC void mprSetSocketResolver(MprSocketResolver resolver)
+{
+    MprSocketService    *ss;
+
+    ss = MPR->socketService;
+    lock(ss);
+    ss->resolver = resolver ? resolver : getAddrInfo;
+    ss->dnsCache = mprCreateHash(0, 0);
+    unlock(ss);
+}
+
+
+PUBLIC void mprSetSocketResolverCache(MprTicks timeout, MprTicks failTimeout)
+{
+    MprSocketService    *ss;
+
+    ss = MPR->socketService;
+    lock(ss);
+    ss->dnsTimeout = timeout;
+    ss->dnsFailTimeout = failTimeout;
+    ss->dnsCache = mprCreateHash(0, 0);
+    unlock(ss);
+}
+
+
+static void resolveEntry(MprSocketService *ss, cchar *ip, DnsEntry *dp)
+{
+    dp->addrlen = sizeof(dp->addr);
+    dp->status = (ss->resolver)(ip, 0, &dp->family, &dp->protocol, &dp->addr, &dp->addrlen);
+}
+
+
+/*
+    Cache a resolved entry. A failed refresh keeps the last good address which continues to be used for up to one
+    more cache period while refreshes are retried.
+ */
+static void cacheEntry(MprSocketService *ss, cchar *ip, DnsEntry *dp)
+{
+    DnsEntry    *prior;
+    MprTicks    now, timeout;
+
+    lock(ss);
+    if (ss->dnsTimeout > 0) {
+        now = mprGetTicks();
+        prior = mprLookupKey(ss->dnsCache, ip);
+        if (dp->status < 0 && prior && prior->status >= 0 && (prior->expires + ss->dnsTimeout) > now) {
+            prior->refreshing = 0;
+
+        } else if ((timeout = (dp->status < 0) ? ss->dnsFailTimeout : ss->dnsTimeout) > 0) {
+            dp->expires = now + timeout;
+            if (mprGetHashLength(ss->dnsCache) >= MPR_DNS_CACHE_MAX) {
+                pruneDnsCache(ss);
+            }
+            mprAddKey(ss->dnsCache, ip, dp);
+
+        } else {
+            mprRemoveKey(ss->dnsCache, ip);
+        }
+    }
+    unlock(ss);
+}
+
+
+/*
+    Remove expired entries. If all are current, start afresh. Keys are collected first as the hash cannot be
+    modified while iterating.
+ */
+static void pruneDnsCache(MprSocketService *ss)
+{
+    MprKey      *kp;
+    MprList     *expired;
+    DnsEntry    *dp;
+    MprTicks    now;
+    char        *key;
+    int         next;
+
+    now = mprGetTicks();
+    expired = mprCreateList(0, 0);
+    for (ITERATE_KEYS(ss->dnsCache, kp)) {
+        dp = (DnsEntry*) kp->data;
+        if (dp->expires <= now && !dp->refreshing) {
+            mprAddItem(expired, kp->key);
+        }
+    }
+    for (ITERATE_ITEMS(expired, key, next)) {
+        mprRemoveKey(ss->dnsCache, key);
+    }
+    if (mprGetHashLength(ss->dnsCache) >= MPR_DNS_CACHE_MAX) {
+        ss->dnsCache = mprCreateHash(0, 0);
+    }
+}
+
+
+static int getDnsEntry(DnsEntry *dp, int port, int *family, int *protocol, struct sockaddr **addr, Socklen *addrlen)
+{
+    if (dp->status < 0) {
+        return dp->status;
+    }
+    if ((*addr = mprAlloc(sizeof(struct sockaddr_storage))) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    memcpy(*addr, &dp->addr, dp->addrlen);
+    if (dp->family == AF_INET6) {
+        ((struct sockaddr_in6*) *addr)->sin6_port = htons((ushort) port);
+    } else {
+        ((struct sockaddr_in*) *addr)->sin_port = htons((ushort) port);
+    }
+    *addrlen = dp->addrlen;
+    *family = dp->family;
+    *protocol = dp->protocol;
+    return 0;
+}
+
+
+static int startResolver(cchar *ip, MprDispatcher *dispatcher, void *proc, void *data)
+{
+    DnsRequest  *req;
+
+    if ((req = mprAllocObj(DnsRequest, manageDnsRequest)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    req->ip = sclone(ip);
+    req->dispatcher = dispatcher;
+    req->proc = proc;
+    req->data = data;
+    return mprStartWorker((MprWorkerProc) resolveWorker, req);
+}
+
+
+static void manageDnsRequest(DnsRequest *req, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(req->ip);
+        mprMark(req->entry);
+        mprMark(req->dispatcher);
+        mprMark(req->data);
+    }
+}
+
+
+/*
+    Resolve on a worker. Yield while resolving so a slow lookup does not delay garbage collection.
+ */
+static void resolveWorker(DnsRequest *req, MprWorker *worker)
+{
+    MprSocketService    *ss;
+
+    ss = MPR->socketService;
+    if ((req->entry = mprAllocObj(DnsEntry, 0)) == 0) {
+        return;
+    }
+    mprYield(MPR_YIELD_STICKY);
+    resolveEntry(ss, req->ip, req->entry);
+    mprResetYield();
+    cacheEntry(ss, req->ip, req->entry);
+    if (req->proc) {
+        mprCreateEvent(req->dispatcher, "resolved", 0, req->proc, req->data, 0);
+    }
+}
+
+
+#if BIT_HAS_GETADDRINFO
+/*
+    Default resolver. If a host provides both IPv4 and IPv6 addresses, prefer the IPv4 address.
+ */
+static int getAddrInfo(cchar *ip, int port, int *family, int *protocol, struct sockaddr_storage *addr, Socklen *addrlen)
+{
+    struct addrinfo     hints, *res, *r;
+    char                *portStr;
+    int                 v6;
+
     memset((char*) &hints, '\0', sizeof(hints));
 
     /*
@@ -1362,7 +2442,6 @@ PUBLIC int mprGetSocketInfo(cchar *ip, int port, int *family, int *protocol, str
      */
     res = 0;
     if (getaddrinfo(ip, portStr, &hints, &res) != 0) {
-        unlock(ss);
         return MPR_ERR_CANT_OPEN;
     }
     /*
@@ -1382,30 +2461,24 @@ PUBLIC int mprGetSocketInfo(cchar *ip, int port, int *family, int *protocol, str
     if (r == NULL) {
         r = res;
     }
-    *addr = mprAlloc(sizeof(struct sockaddr_storage));
-    mprMemcpy((char*) *addr, sizeof(struct sockaddr_storage), (char*) r->ai_addr, (int) r->ai_addrlen);
+    mprMemcpy((char*) addr, sizeof(struct sockaddr_storage), (char*) r->ai_addr, (int) r->ai_addrlen);
 
     *addrlen = (int) r->ai_addrlen;
     *family = r->ai_family;
     *protocol = r->ai_protocol;
 
     freeaddrinfo(res);
-    unlock(ss);
     return 0;
 }
 #else
 
-PUBLIC int mprGetSocketInfo(cchar *ip, int port, int *family, int *protocol, struct sockaddr **addr, Socklen *addrlen)
+static int getAddrInfo(cchar *ip, int port, int *family, int *protocol, struct sockaddr_storage *addr, Socklen *addrlen)
 {
     MprSocketService    *ss;
     struct sockaddr_in  *sa;
 
     ss = MPR->socketService;
-
-    if ((sa = mprAllocStruct(struct sockaddr_in)) == 0) {
-        assert(!MPR_ERR_MEMORY);
-        return MPR_ERR_MEMORY;
-    }
+    sa = (struct sockaddr_in*) addr;
     memset((char*) sa, '\0', sizeof(struct sockaddr_in));
     sa->sin_family = AF_INET;
     sa->sin_port = htons((short) (port & 0xFFFF));
@@ -1444,7 +2517,6 @@ PUBLIC int mprGetSocketInfo(cchar *ip, int port, int *family, int *protocol, str
         memcpy((char*) &sa->sin_addr, (char*) hostent->h_addr_list[0], (ssize) hostent->h_length);
 #endif
     }
-    *addr = (struct sockaddr*) sa;
     *addrlen = sizeof(struct sockaddr_in);
     *family = sa->sin_family;
     *protocol = 0;
@@ -1499,6 +2571,15 @@ static int getSocketIpAddr(struct sockaddr *addr, int addrlen, char *ip, int ipL
 }
 
 
+static int getSocketAddrPort(struct sockaddr *addr)
+{
+    if (addr->sa_family == AF_INET6) {
+        return ntohs(((struct sockaddr_in6*) addr)->sin6_port);
+    }
+    return ntohs(((struct sockaddr_in*) addr)->sin_port);
+}
+
+
 /*
     Looks like an IPv6 address if it has 2 or more colons
  */
@@ -1636,7 +2717,10 @@ PUBLIC bool mprIsSocketSecure(MprSocket *sp)
 
 PUBLIC bool mprIsSocketV6(MprSocket *sp)
 {
-    return sp->ip && ipv6(sp->ip);
+    cchar   *ip;
+
+    ip = mprGetSocketIp(sp);
+    return ip && ipv6(ip);
 }
 
 
@@ -479,8 +479,8 @@ static char *getEstState(MprSocket *sp)
     buf = mprCreateBuf(0, 0);
     mprPutToBuf(buf, "PROVIDER=est,CIPHER=%s,", ssl_get_cipher(ctx));
 
-    own =  sp->acceptIp ? "SERVER_" : "CLIENT_";
-    peer = sp->acceptIp ? "CLIENT_" : "SERVER_";
+    own =  (sp->flags & MPR_SOCKET_SERVER) ? "SERVER_" : "CLIENT_";
+    peer = (sp->flags & MPR_SOCKET_SERVER) ? "CLIENT_" : "SERVER_";
     if (ctx->peer_cert) {
         x509parse_cert_info(peer, cbuf, sizeof(cbuf), ctx->peer_cert);
         mprPutStringToBuf(buf, cbuf);
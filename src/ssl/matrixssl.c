@@ -285,7 +285,7 @@ static char *getMssState(MprSocket *sp)
     buf = mprCreateBuf(0, 0);
     mprPutToBuf(buf, "PROVIDER=matrixssl,CIPHER=%s,", cipherName ? cipherName: "unknown");
     mprPutBlockToBuf(buf, mprGetBufStart(msp->peerCert), mprGetBufLength(msp->peerCert));
-    parseCert(buf, sp->acceptIp ? "CLIENT" : "SERVER", ctx->keys->cert);
+    parseCert(buf, (sp->flags & MPR_SOCKET_SERVER) ? "CLIENT" : "SERVER", ctx->keys->cert);
     mprLog(5, "MatrixSSL certs: %s", mprGetBufStart(buf));
     return mprGetBufStart(buf);
 }
@@ -425,7 +425,7 @@ static int verifyCert(ssl_t *ssl, psX509Cert_t *cert, int32 alert)
         Must parse here as MatrixSSL frees this if you have both client and server enabled in the library
      */
     msp->peerCert = mprCreateBuf(0, 0);
-    parseCert(msp->peerCert, sp->acceptIp ? "SERVER" : "CLIENT", cert);
+    parseCert(msp->peerCert, (sp->flags & MPR_SOCKET_SERVER) ? "SERVER" : "CLIENT", cert);
     mprLog(3, "MatrixSSL: Certificate verified");
     mprLog(4, "MatrixSSL: %s", mprGetBufStart(msp->peerCert));
     return PS_SUCCESS;
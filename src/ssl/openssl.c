@@ -487,7 +487,7 @@ static char *getOssState(MprSocket *sp)
     mprPutToBuf(buf, "PROVIDER=openssl,CIPHER=%s,", SSL_get_cipher(osp->handle));
 
     if ((cert = SSL_get_peer_certificate(osp->handle)) != 0) {
-        prefix = sp->acceptIp ? "CLIENT_" : "SERVER_";
+        prefix = (sp->flags & MPR_SOCKET_SERVER) ? "CLIENT_" : "SERVER_";
         X509_NAME_oneline(X509_get_subject_name(cert), subject, sizeof(subject) -1);
         parseCertFields(buf, prefix, "S_", &subject[1]);
 
@@ -496,7 +496,7 @@ static char *getOssState(MprSocket *sp)
         X509_free(cert);
     }
     if ((cert = SSL_get_certificate(osp->handle)) != 0) {
-        prefix =  sp->acceptIp ? "SERVER_" : "CLIENT_";
+        prefix =  (sp->flags & MPR_SOCKET_SERVER) ? "SERVER_" : "CLIENT_";
         X509_NAME_oneline(X509_get_subject_name(cert), subject, sizeof(subject) -1);
         parseCertFields(buf, prefix, "S_", &subject[1]);
 
@@ -14,13 +14,24 @@
 
 static void changeState(MprWorker *worker, int state);
 static MprWorker *createWorker(MprWorkerService *ws, ssize stackSize);
+static bool findTask(MprWorker *worker);
 static int getNextThreadNum(MprWorkerService *ws);
+static MprTicks getQueuedDelay(MprWorkerService *ws);
 static void manageThreadService(MprThreadService *ts, int flags);
 static void manageThread(MprThread *tp, int flags);
 static void manageWorker(MprWorker *worker, int flags);
 static void manageWorkerService(MprWorkerService *ws, int flags);
+static void placeWorker(MprWorkerService *ws, MprWorker *worker);
+static int pruneIdleWorkers(MprWorkerService *ws, int keep, MprTicks timeout);
 static void pruneWorkers(MprWorkerService *ws, MprEvent *timer);
+static bool queueTask(MprWorker *worker, MprWorkerProc proc, void *data);
+static bool takeTask(MprWorker *worker, MprWorker *victim);
+#if MPR_AFFINITY
+static int applyAffinity(MprThread *tp);
+static int parseCpus(cchar *cpus, cpu_set_t *set);
+#endif
 static void threadProc(MprThread *tp);
+static void tuneWorkers(MprWorkerService *ws, MprEvent *timer);
 static void workerMain(MprWorker *worker, MprThread *tp);
 
 /************************************ Code ***********************************/
@@ -49,6 +60,18 @@ PUBLIC MprThreadService *mprCreateThreadService()
     }
     ts->mainThread->isMain = 1;
     ts->mainThread->osThread = mprGetCurrentOsThread();
+#if MPR_AFFINITY
+    /*
+        Save the process CPU mask which may be restricted by a cpuset or taskset. Threads without an affinity are
+        restored to this mask.
+     */
+    if ((ts->cpus = mprAlloc(sizeof(cpu_set_t))) == 0) {
+        return 0;
+    }
+    if (sched_getaffinity(0, sizeof(cpu_set_t), ts->cpus) < 0) {
+        CPU_ZERO((cpu_set_t*) ts->cpus);
+    }
+#endif
     return ts;
 }
 
@@ -64,6 +87,7 @@ static void manageThreadService(MprThreadService *ts, int flags)
         mprMark(ts->threads);
         mprMark(ts->mainThread);
         mprMark(ts->cond);
+        mprMark(ts->cpus);
 
     } else if (flags & MPR_MANAGE_FREE) {
         mprStopThreadService();
@@ -172,6 +196,7 @@ static void manageThread(MprThread *tp, int flags)
         mprMark(tp->data);
         mprMark(tp->cond);
         mprMark(tp->mutex);
+        mprMark(tp->affinity);
 
     } else if (flags & MPR_MANAGE_FREE) {
         if (ts->threads) {
@@ -226,6 +251,11 @@ static void threadProc(MprThread *tp)
     tp->pid = tp->osThread;
 #else
     tp->pid = getpid();
+#endif
+#if MPR_AFFINITY
+    if (tp->affinity) {
+        applyAffinity(tp);
+    }
 #endif
     (tp->entry)(tp->data, tp);
     mprRemoveItem(MPR->threadService->threads, tp);
@@ -323,6 +353,156 @@ PUBLIC void mprSetThreadPriority(MprThread *tp, int newPriority)
 }
 
 
+#if MPR_AFFINITY
+/*
+    Parse a CPU list of numbers and ranges. For example: "0-3,8"
+ */
+static int parseCpus(cchar *cpus, cpu_set_t *set)
+{
+    char    *buf, *tok, *next, *dash;
+    int     cpu, lo, hi;
+
+    CPU_ZERO(set);
+    buf = sclone(cpus);
+    for (tok = stok(buf, ",", &next); tok; tok = stok(NULL, ",", &next)) {
+        tok = strim(tok, " \t\r\n", MPR_TRIM_BOTH);
+        if (*tok == '\0') {
+            continue;
+        }
+        if (!isdigit((uchar) *tok)) {
+            return MPR_ERR_BAD_ARGS;
+        }
+        lo = hi = (int) stoi(tok);
+        if ((dash = schr(tok, '-')) != 0) {
+            if (!isdigit((uchar) dash[1])) {
+                return MPR_ERR_BAD_ARGS;
+            }
+            hi = (int) stoi(&dash[1]);
+        }
+        if (lo < 0 || hi < lo || hi >= CPU_SETSIZE) {
+            return MPR_ERR_BAD_ARGS;
+        }
+        for (cpu = lo; cpu <= hi; cpu++) {
+            CPU_SET(cpu, set);
+        }
+    }
+    return CPU_COUNT(set) > 0 ? 0 : MPR_ERR_BAD_ARGS;
+}
+
+
+/*
+    Apply the thread affinity. A thread without an affinity is restored to the process CPU mask. Must be called by the
+    thread or after the thread has started.
+ */
+static int applyAffinity(MprThread *tp)
+{
+    cpu_set_t   set;
+    int         cpu;
+
+    if (tp->affinity) {
+        if (parseCpus(tp->affinity, &set) < 0) {
+            return MPR_ERR_BAD_ARGS;
+        }
+    } else if (CPU_COUNT((cpu_set_t*) MPR->threadService->cpus) > 0) {
+        set = *(cpu_set_t*) MPR->threadService->cpus;
+    } else {
+        CPU_ZERO(&set);
+        for (cpu = 0; cpu < CPU_SETSIZE; cpu++) {
+            CPU_SET(cpu, &set);
+        }
+    }
+    if (pthread_setaffinity_np(tp->osThread, sizeof(set), &set) != 0) {
+        mprError("Cannot set affinity for thread %s to \"%s\"", tp->name, tp->affinity);
+        return MPR_ERR_CANT_COMPLETE;
+    }
+    return 0;
+}
+#endif
+
+
+PUBLIC int mprSetThreadAffinity(MprThread *tp, cchar *cpus)
+{
+#if MPR_AFFINITY
+    cpu_set_t   set;
+    int         rc;
+
+    if (cpus && parseCpus(cpus, &set) < 0) {
+        return MPR_ERR_BAD_ARGS;
+    }
+    lock(tp);
+    tp->affinity = cpus ? sclone(cpus) : 0;
+    rc = tp->osThread ? applyAffinity(tp) : 0;
+    unlock(tp);
+    return rc;
+#else
+    return MPR_ERR_BAD_STATE;
+#endif
+}
+
+
+PUBLIC int mprSetEventsAffinity(cchar *cpus)
+{
+    MprThreadService    *ts;
+
+    ts = MPR->threadService;
+    return mprSetThreadAffinity(ts->eventsThread ? ts->eventsThread : ts->mainThread, cpus);
+}
+
+
+PUBLIC int mprSetGCAffinity(cchar *cpus)
+{
+    if (!MPR->heap->gc) {
+        return MPR_ERR_BAD_STATE;
+    }
+    return mprSetThreadAffinity(MPR->heap->gc, cpus);
+}
+
+
+/*
+    Count the NUMA nodes. The topology is read once.
+ */
+PUBLIC int mprGetNumaNodes()
+{
+#if MPR_AFFINITY
+    static int  numaNodes = 0;
+    char        path[64];
+    int         n;
+
+    if (numaNodes == 0) {
+        for (n = 0; ; n++) {
+            fmt(path, sizeof(path), "/sys/devices/system/node/node%d", n);
+            if (!mprPathExists(path, X_OK)) {
+                break;
+            }
+        }
+        numaNodes = max(n, 1);
+    }
+    return numaNodes;
+#else
+    return 1;
+#endif
+}
+
+
+PUBLIC char *mprGetNumaNodeCpus(int node)
+{
+#if MPR_AFFINITY
+    char    *data;
+
+    if (node < 0) {
+        return 0;
+    }
+    if ((data = mprReadPathContents(sfmt("/sys/devices/system/node/node%d/cpulist", node), NULL)) != 0) {
+        return strim(data, " \t\r\n", MPR_TRIM_BOTH);
+    }
+    if (node == 0) {
+        return sfmt("0-%d", max(MPR->heap->stats.numCpu, 1) - 1);
+    }
+#endif
+    return 0;
+}
+
+
 static void manageThreadLocal(MprThreadLocal *tls, int flags)
 {
     if (flags & MPR_MANAGE_MARK) {
@@ -548,6 +728,8 @@ PUBLIC MprWorkerService *mprCreateWorkerService()
     mprSetListLimits(ws->idleThreads, ws->maxThreads, -1);
     ws->busyThreads = mprCreateList(0, 0);
     mprSetListLimits(ws->busyThreads, ws->maxThreads, -1);
+    ws->workers = mprCreateList(0, 0);
+    mprSetListLimits(ws->workers, ws->maxThreads, -1);
     return ws;
 }
 
@@ -557,8 +739,11 @@ static void manageWorkerService(MprWorkerService *ws, int flags)
     if (flags & MPR_MANAGE_MARK) {
         mprMark(ws->busyThreads);
         mprMark(ws->idleThreads);
+        mprMark(ws->workers);
         mprMark(ws->mutex);
         mprMark(ws->pruneTimer);
+        mprMark(ws->tuneTimer);
+        mprMark(ws->affinity);
     }
 }
 
@@ -585,6 +770,10 @@ PUBLIC void mprStopWorkers()
         mprRemoveEvent(ws->pruneTimer);
         ws->pruneTimer = 0;
     }
+    if (ws->tuneTimer) {
+        mprRemoveEvent(ws->tuneTimer);
+        ws->tuneTimer = 0;
+    }
     /*
         Wake up all idle workers. Busy workers take care of themselves. An idle thread will wakeup, exit and be 
         removed from the busy list and then delete the thread. We progressively remove the last thread in the idle
@@ -643,6 +832,84 @@ PUBLIC void mprSetMaxWorkers(int n)
 }
 
 
+/*
+    Enable adaptive pool sizing. The controller runs each latency period.
+ */
+PUBLIC void mprSetWorkerLatency(MprTicks latency)
+{
+    MprWorkerService    *ws;
+    MprTicks            period;
+
+    ws = MPR->workerService;
+    lock(ws);
+    ws->latency = max(latency, 0);
+    if (ws->latency > 0) {
+        if (ws->target == 0) {
+            ws->target = max(MPR->heap->stats.numCpu, 1);
+        }
+        period = max(ws->latency, MPR_TIMEOUT_NAP);
+        if (ws->tuneTimer) {
+            mprRescheduleEvent(ws->tuneTimer, period);
+        } else {
+            ws->tuneTimer = mprCreateTimerEvent(NULL, "tuneWorkers", period, tuneWorkers, ws, MPR_EVENT_QUICK);
+        }
+    } else {
+        ws->target = 0;
+        if (ws->tuneTimer) {
+            mprRemoveEvent(ws->tuneTimer);
+            ws->tuneTimer = 0;
+        }
+    }
+    unlock(ws);
+}
+
+
+/*
+    Bind existing and future workers to CPUs
+ */
+PUBLIC int mprSetWorkerAffinity(cchar *cpus, int flags)
+{
+#if MPR_AFFINITY
+    MprWorkerService    *ws;
+    MprWorker           *worker;
+    cpu_set_t           set;
+    int                 next;
+
+    if (cpus && !(flags & MPR_AFFINITY_NODES) && parseCpus(cpus, &set) < 0) {
+        return MPR_ERR_BAD_ARGS;
+    }
+    ws = MPR->workerService;
+    lock(ws);
+    ws->affinity = (cpus && !(flags & MPR_AFFINITY_NODES)) ? sclone(cpus) : 0;
+    ws->affinityFlags = flags;
+    ws->nextNode = 0;
+    for (ITERATE_ITEMS(ws->workers, worker, next)) {
+        placeWorker(ws, worker);
+    }
+    unlock(ws);
+    return 0;
+#else
+    return MPR_ERR_BAD_STATE;
+#endif
+}
+
+
+/*
+    Bind a worker to the worker CPU list or to the CPUs of the next NUMA node. Must be called locked.
+ */
+static void placeWorker(MprWorkerService *ws, MprWorker *worker)
+{
+    worker->node = -1;
+    if (ws->affinityFlags & MPR_AFFINITY_NODES) {
+        worker->node = ws->nextNode++ % mprGetNumaNodes();
+        mprSetThreadAffinity(worker->thread, mprGetNumaNodeCpus(worker->node));
+
+    } else if (ws->affinity || worker->thread->affinity) {
+        mprSetThreadAffinity(worker->thread, ws->affinity);
+    }
+}
+
+
 PUBLIC int mprGetMaxWorkers()
 {
     return MPR->workerService->maxThreads;
@@ -709,6 +976,12 @@ PUBLIC void mprGetWorkerStats(MprWorkerStats *stats)
 
     stats->idle = (int) ws->idleThreads->length;
     stats->busy = (int) ws->busyThreads->length;
+    stats->queued = ws->queued;
+    stats->steals = ws->steals;
+    stats->target = ws->target;
+    stats->delay = (int) ws->delay;
+    stats->grown = ws->grown;
+    stats->shrunk = ws->shrunk;
 
     stats->yielded = 0;
     for (ITERATE_ITEMS(ws->busyThreads, wp, next)) {
@@ -725,18 +998,19 @@ PUBLIC void mprGetWorkerStats(MprWorkerStats *stats)
 PUBLIC int mprAvailableWorkers()
 {
     MprWorkerStats  wstats;
-    int             activeWorkers, spareThreads, spareCores, result;
+    int             activeWorkers, spareThreads, spareCores, cores, result;
 
     mprGetWorkerStats(&wstats);
     /*
         SpareThreads    == Threads that can be created up to max threads
         ActiveWorkers   == Worker threads actively servicing requests
-        SpareCores      == Cores available on the system
+        SpareCores      == Cores available on the system (or the adaptive target if enabled)
         Result          == Idle workers + lesser of SpareCores|SpareThreads
      */
+    cores = wstats.target ? wstats.target : MPR->heap->stats.numCpu;
     spareThreads = wstats.max - wstats.busy - wstats.idle;
     activeWorkers = wstats.busy - wstats.yielded;
-    spareCores = MPR->heap->stats.numCpu - activeWorkers;
+    spareCores = cores - activeWorkers;
     if (spareCores <= 0) {
         return 0;
     }
@@ -753,6 +1027,7 @@ PUBLIC int mprStartWorker(MprWorkerProc proc, void *data)
 {
     MprWorkerService    *ws;
     MprWorker           *worker;
+    int                 count, i;
 
     ws = MPR->workerService;
     lock(ws);
@@ -769,11 +1044,7 @@ PUBLIC int mprStartWorker(MprWorkerProc proc, void *data)
         worker->proc = proc;
         changeState(worker, MPR_WORKER_BUSY);
 
-    } else if (ws->numThreads < ws->maxThreads) {
-        if (mprAvailableWorkers() == 0) {
-            unlock(ws);
-            return MPR_ERR_BUSY;
-        }
+    } else if (ws->numThreads < ws->maxThreads && mprAvailableWorkers() > 0) {
         worker = createWorker(ws, ws->stackSize);
         ws->numThreads++;
         ws->maxUsedThreads = max(ws->numThreads, ws->maxUsedThreads);
@@ -783,10 +1054,25 @@ PUBLIC int mprStartWorker(MprWorkerProc proc, void *data)
         mprStartThread(worker->thread);
 
     } else {
-        unlock(ws);
-        return MPR_ERR_BUSY;
+        /*
+            Queue on a busy worker that is running (not blocked in user code) and has room in its run queue. 
+            Otherwise return busy so the caller can apply back-pressure. This is done while locked so that a worker 
+            going idle will see the task when it rechecks the run queues.
+         */
+        count = (int) ws->busyThreads->length;
+        for (i = 0; i < count; i++) {
+            worker = mprGetItem(ws->busyThreads, (ws->nextVictim++ & MAXINT) % count);
+            if (!(worker->thread && worker->thread->yielded && worker->running) && queueTask(worker, proc, data)) {
+                break;
+            }
+            worker = 0;
+        }
+        if (!worker) {
+            unlock(ws);
+            return MPR_ERR_BUSY;
+        }
     }
-    if (!ws->pruneTimer && (ws->numThreads < ws->minThreads)) {
+    if (!ws->pruneTimer && (ws->numThreads > ws->minThreads)) {
         ws->pruneTimer = mprCreateTimerEvent(NULL, "pruneWorkers", MPR_TIMEOUT_PRUNER, pruneWorkers, ws, MPR_EVENT_QUICK);
     }
     unlock(ws);
@@ -794,25 +1080,158 @@ PUBLIC int mprStartWorker(MprWorkerProc proc, void *data)
 }
 
 
+/*
+    Wake a preferred idle worker so the callback runs with warm caches. Otherwise use any worker.
+ */
+PUBLIC int mprStartPreferredWorker(MprWorker *worker, MprWorkerProc proc, void *data)
+{
+    MprWorkerService    *ws;
+
+    ws = MPR->workerService;
+    if (worker && worker->state == MPR_WORKER_IDLE) {
+        lock(ws);
+        if (worker->state == MPR_WORKER_IDLE) {
+            worker->data = data;
+            worker->proc = proc;
+            changeState(worker, MPR_WORKER_BUSY);
+            unlock(ws);
+            return 0;
+        }
+        unlock(ws);
+    }
+    return mprStartWorker(proc, data);
+}
+
+
+/*
+    Add a task to the worker run queue
+ */
+static bool queueTask(MprWorker *worker, MprWorkerProc proc, void *data)
+{
+    MprWorkerTask   *task;
+
+    mprSpinLock(worker->spin);
+    if (worker->qcount >= MPR_WORKER_QUEUE) {
+        mprSpinUnlock(worker->spin);
+        return 0;
+    }
+    task = &worker->queue[(worker->qfirst + worker->qcount) % MPR_WORKER_QUEUE];
+    task->proc = proc;
+    task->data = data;
+    task->queued = MPR->eventService->now;
+    worker->qcount++;
+    mprSpinUnlock(worker->spin);
+    mprAtomicAdd(&worker->workerService->queued, 1);
+    return 1;
+}
+
+
+/*
+    Take the oldest task from the victim run queue and make it the worker's current task
+ */
+static bool takeTask(MprWorker *worker, MprWorker *victim)
+{
+    MprWorkerTask   *task;
+
+    if (victim->qcount == 0) {
+        return 0;
+    }
+    mprSpinLock(victim->spin);
+    if (victim->qcount == 0) {
+        mprSpinUnlock(victim->spin);
+        return 0;
+    }
+    task = &victim->queue[victim->qfirst];
+    worker->proc = task->proc;
+    worker->data = task->data;
+    task->proc = 0;
+    task->data = 0;
+    victim->qfirst = (victim->qfirst + 1) % MPR_WORKER_QUEUE;
+    victim->qcount--;
+    mprSpinUnlock(victim->spin);
+
+    mprAtomicAdd(&worker->workerService->queued, -1);
+    if (victim != worker) {
+        mprAtomicAdd(&worker->workerService->steals, 1);
+    }
+    return 1;
+}
+
+
+/*
+    Find a task from the worker's own run queue, otherwise steal from another worker. The workers list is scanned 
+    without locking. Workers are only freed by the GC which cannot run while this thread is active.
+ */
+static bool findTask(MprWorker *worker)
+{
+    MprWorkerService    *ws;
+    MprWorker           *victim;
+    int                 i, count, pass;
+
+    ws = worker->workerService;
+    if (takeTask(worker, worker)) {
+        return 1;
+    }
+    if (ws->queued <= 0) {
+        return 0;
+    }
+    /*
+        Workers placed on NUMA nodes steal from workers on the same node first
+     */
+    count = (int) ws->workers->length;
+    for (pass = (worker->node < 0) ? 1 : 0; pass < 2; pass++) {
+        for (i = 0; i < count; i++) {
+            if ((victim = mprGetItem(ws->workers, i)) == 0 || victim == worker) {
+                continue;
+            }
+            if (worker->node >= 0 && (pass == 0) != (victim->node == worker->node)) {
+                continue;
+            }
+            if (takeTask(worker, victim)) {
+                return 1;
+            }
+        }
+    }
+    return 0;
+}
+
+
 /*
     Trim idle workers
  */
 static void pruneWorkers(MprWorkerService *ws, MprEvent *timer)
 {
-    MprWorker     *worker;
-    int           index, pruned;
+    int     pruned;
 
     if (mprGetDebugMode()) {
         return;
     }
     lock(ws);
+    pruned = pruneIdleWorkers(ws, ws->minThreads, MPR_TIMEOUT_WORKER);
+    if (timer && (ws->numThreads - pruned) <= ws->minThreads) {
+        mprRemoveEvent(ws->pruneTimer);
+        ws->pruneTimer = 0;
+    }
+    unlock(ws);
+}
+
+
+/*
+    Prune workers that have been idle longer than the timeout while the pool has more than "keep" workers. 
+    Must be called locked.
+ */
+static int pruneIdleWorkers(MprWorkerService *ws, int keep, MprTicks timeout)
+{
+    MprWorker     *worker;
+    int           index, pruned;
+
     pruned = 0;
     for (index = 0; index < ws->idleThreads->length; index++) {
-        if (ws->numThreads <= ws->minThreads) {
+        if ((ws->numThreads - pruned) <= keep) {
             break;
         }
         worker = mprGetItem(ws->idleThreads, index);
-        if ((worker->lastActivity + MPR_TIMEOUT_WORKER) < MPR->eventService->now) {
+        if ((worker->lastActivity + timeout) < MPR->eventService->now) {
             changeState(worker, MPR_WORKER_PRUNED);
             pruned++;
             index--;
@@ -822,11 +1241,90 @@ static void pruneWorkers(MprWorkerService *ws, MprEvent *timer)
         mprLog(4, "Pruned %d workers, pool has %d workers. Limits %d-%d.", 
             pruned, ws->numThreads - pruned, ws->minThreads, ws->maxThreads);
     }
-    if (timer && (ws->numThreads < ws->minThreads)) {
-        mprRemoveEvent(ws->pruneTimer);
-        ws->pruneTimer = 0;
+    return pruned;
+}
+
+
+/*
+    Adaptive pool sizing controller. Raise the limit of running workers if the oldest dispatcher or task waiting for a 
+    worker has waited longer than the latency target. Workers blocked in I/O (yielded) do not count against the limit,
+    so the limit is raised by at least their number. New workers steal tasks queued on busy workers.
+    If nothing is waiting and workers are idle, step the limit back toward the CPU count and prune excess workers.
+ */
+static void tuneWorkers(MprWorkerService *ws, MprEvent *timer)
+{
+    MprWorkerStats  stats;
+    MprWorker       *worker;
+    MprTicks        delay;
+    int             cores, grew, step;
+
+    delay = max(mprGetPendingDispatcherDelay(), getQueuedDelay(ws));
+    mprGetWorkerStats(&stats);
+    cores = max(MPR->heap->stats.numCpu, 1);
+    grew = 0;
+
+    lock(ws);
+    ws->delay = delay;
+    if (ws->latency > 0) {
+        if (delay > ws->latency) {
+            if (ws->target < ws->maxThreads) {
+                step = max(stats.yielded, 1);
+                ws->target = min(ws->target + step, ws->maxThreads);
+                ws->grown++;
+                grew = 1;
+                mprLog(4, "Raise worker limit to %d, task waited %Ld msec, busy %d, yielded %d, queued %d", 
+                    ws->target, delay, stats.busy, stats.yielded, stats.queued);
+                for (; step > 0 && ws->queued > 0 && ws->numThreads < ws->maxThreads; step--) {
+                    worker = createWorker(ws, ws->stackSize);
+                    ws->numThreads++;
+                    ws->maxUsedThreads = max(ws->numThreads, ws->maxUsedThreads);
+                    changeState(worker, MPR_WORKER_BUSY);
+                    mprStartThread(worker->thread);
+                }
+            }
+        } else if (delay == 0 && stats.idle > 0) {
+            if (ws->target > cores) {
+                ws->target--;
+                ws->shrunk++;
+                mprLog(4, "Lower worker limit to %d, idle %d", ws->target, stats.idle);
+            }
+            if (!mprGetDebugMode()) {
+                pruneIdleWorkers(ws, max(ws->minThreads, ws->target), MPR_TIMEOUT_WORKER_TUNE);
+            }
+        }
     }
     unlock(ws);
+    if (grew) {
+        mprWakePendingDispatchers();
+    }
+}
+
+
+/*
+    Return how long the oldest task queued on a busy worker has been waiting
+ */
+static MprTicks getQueuedDelay(MprWorkerService *ws)
+{
+    MprWorker   *worker;
+    MprTicks    now, delay;
+    int         i, count;
+
+    delay = 0;
+    if (ws->queued <= 0) {
+        return delay;
+    }
+    now = mprGetTicks();
+    count = (int) ws->workers->length;
+    for (i = 0; i < count; i++) {
+        if ((worker = mprGetItem(ws->workers, i)) != 0 && worker->qcount > 0) {
+            mprSpinLock(worker->spin);
+            if (worker->qcount > 0) {
+                delay = max(delay, now - worker->queue[worker->qfirst].queued);
+            }
+            mprSpinUnlock(worker->spin);
+        }
+    }
+    return delay;
 }
 
 
@@ -864,21 +1362,30 @@ static MprWorker *createWorker(MprWorkerService *ws, ssize stackSize)
     }
     worker->workerService = ws;
     worker->idleCond = mprCreateCond();
+    worker->spin = mprCreateSpinLock();
+    mprAddItem(ws->workers, worker);
 
     fmt(name, sizeof(name), "worker.%u", getNextThreadNum(ws));
     mprLog(4, "Create %s, pool has %d workers. Limits %d-%d.", name, ws->numThreads + 1, ws->minThreads, ws->maxThreads);
     worker->thread = mprCreateThread(name, (MprThreadProc) workerMain, worker, stackSize);
+    placeWorker(ws, worker);
     return worker;
 }
 
 
 static void manageWorker(MprWorker *worker, int flags)
 {
+    int     i;
+
     if (flags & MPR_MANAGE_MARK) {
         mprMark(worker->data);
         mprMark(worker->thread);
         mprMark(worker->workerService);
         mprMark(worker->idleCond);
+        mprMark(worker->spin);
+        for (i = 0; i < worker->qcount; i++) {
+            mprMark(worker->queue[(worker->qfirst + i) % MPR_WORKER_QUEUE].data);
+        }
     }
 }
 
@@ -914,8 +1421,27 @@ static void workerMain(MprWorker *worker, MprThread *tp)
         }
         worker->proc = 0;
         worker->data = 0;
+
+        /*
+            Run queued tasks before returning to the idle pool
+         */
+        if (findTask(worker)) {
+            continue;
+        }
         changeState(worker, MPR_WORKER_IDLE);
 
+        /*
+            Recheck the run queues now this worker is visible as idle. mprStartWorker queues tasks while locked.
+         */
+        lock(ws);
+        if (worker->state == MPR_WORKER_IDLE && findTask(worker)) {
+            changeState(worker, MPR_WORKER_BUSY);
+            mprResetCond(worker->idleCond);
+            unlock(ws);
+            continue;
+        }
+        unlock(ws);
+
         /*
             Sleep till there is more work to do. Yield for GC first.
          */
@@ -925,6 +1451,7 @@ static void workerMain(MprWorker *worker, MprThread *tp)
     }
     lock(ws);
     changeState(worker, 0);
+    mprRemoveItem(ws->workers, worker);
     worker->thread = 0;
     ws->numThreads--;
     unlock(ws);
@@ -383,6 +383,38 @@ PUBLIC MprTicks mprGetTicks()
 }
 
 
+/*
+    Return time in microseconds that never goes backwards. Used for fine grained intervals such as event loop spinning.
+ */
+PUBLIC uint64 mprGetMicroTicks()
+{
+#if BIT_WIN_LIKE
+    static LARGE_INTEGER freq;
+    LARGE_INTEGER   now;
+
+    if (freq.QuadPart == 0) {
+        QueryPerformanceFrequency(&freq);
+    }
+    QueryPerformanceCounter(&now);
+    return (uint64) (now.QuadPart / freq.QuadPart * 1000000 + (now.QuadPart % freq.QuadPart) * 1000000 / freq.QuadPart);
+#elif MACOSX
+    mach_timebase_info_data_t info;
+    mach_timebase_info(&info);
+    return mach_absolute_time() * info.numer / info.denom / 1000;
+#elif CLOCK_MONOTONIC_RAW
+    struct timespec tv;
+    clock_gettime(CLOCK_MONOTONIC_RAW, &tv);
+    return ((uint64) tv.tv_sec) * 1000000 + (tv.tv_nsec / 1000);
+#elif CLOCK_MONOTONIC
+    struct timespec tv;
+    clock_gettime(CLOCK_MONOTONIC, &tv);
+    return ((uint64) tv.tv_sec) * 1000000 + (tv.tv_nsec / 1000);
+#else
+    return ((uint64) mprGetTicks()) * 1000;
+#endif
+}
+
+
 /*
     Return the number of milliseconds until the given timeout has expired.
  */
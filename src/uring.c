@@ -0,0 +1,500 @@
+/**
+    uring.c - Wait for I/O by using io_uring on Linux systems.
+
+    This module augments the mprWait wait services module by providing io_uring based waiting support. It is layered
+    over the epoll module which is used instead if the kernel lacks io_uring support. File descriptors are monitored
+    via one-shot poll requests and the wait service is awakened by polling the epoll break eventfd. The ring is also
+    used to submit file reads and socket receive/send requests via mprSubmitIO. This module is thread-safe.
+
+    Copyright (c) All Rights Reserved. See details at the end of the file.
+ */
+
+/********************************* Includes ***********************************/
+
+#include    "mpr.h"
+
+#if MPR_EVENT_IO_URING
+#include    <linux/io_uring.h>
+#include    <sys/syscall.h>
+
+/*********************************** Locals ***********************************/
+
+#define URING_ENTRIES   256                 /* Size of the submission queue */
+
+/*
+    Completion user_data tags. Poll requests store the fd in the low word and a sequence number in the high word.
+    The sequence is saved in wp->notifierIndex and is used to discard completions for stale poll requests.
+ */
+#define URING_WAKE      (1ULL << 63)        /* Wakeup eventfd poll */
+#define URING_IGNORE    (1ULL << 62)        /* Completions of no interest (poll removal) */
+#define URING_REQUEST   (1ULL << 61)        /* MprIORequest completion. Low bits are the request reference */
+#define URING_TAGS      (URING_WAKE | URING_IGNORE | URING_REQUEST)
+#define URING_SEQ_MASK  0x1FFFFFFF
+
+#define pollData(fd, seq) (((uint64) (seq) << 32) | (uint) (fd))
+
+typedef struct MprUring {
+    int                 fd;                 /* io_uring descriptor */
+    uint                sqEntries;          /* Size of the submission queue */
+    uint                *sqHead;            /* Submission queue head (updated by the kernel) */
+    uint                *sqTail;            /* Submission queue tail */
+    uint                *sqMask;            /* Submission ring index mask */
+    uint                *sqArray;           /* Submission ring array of sqe indexes */
+    uint                *cqHead;            /* Completion queue head */
+    uint                *cqTail;            /* Completion queue tail (updated by the kernel) */
+    uint                *cqMask;            /* Completion ring index mask */
+    struct io_uring_sqe *sqes;              /* Submission queue entries */
+    struct io_uring_cqe *cqes;              /* Completion queue entries */
+    void                *ringMem;           /* Mapped submission and completion rings */
+    size_t              ringSize;           /* Size of ringMem */
+    size_t              sqesSize;           /* Size of mapped sqes */
+    uint                seq;                /* Next poll sequence number */
+    int                 servicing;          /* Processing completions. Submit once at the end of the batch */
+    MprList             *requests;          /* In-flight I/O requests. Retained here for GC */
+} MprUring;
+
+/********************************** Forwards **********************************/
+
+static void armPoll(MprUring *ring, MprWaitHandler *wp, int mask);
+static void armWakeup(MprWaitService *ws);
+static void manageRing(MprUring *ring, int flags);
+static int queueSqe(MprUring *ring, int op, int fd, uint64 addr, uint len, uint64 off, uint opflags, uint64 data);
+static void serviceIO(MprWaitService *ws);
+static int submit(MprUring *ring);
+static void termRing(MprUring *ring);
+
+/************************************ Code ************************************/
+
+static int uringSetup(uint entries, struct io_uring_params *params)
+{
+    return (int) syscall(__NR_io_uring_setup, entries, params);
+}
+
+
+static int uringEnter(int fd, uint toSubmit, uint minComplete, uint flags, void *arg, size_t argSize)
+{
+    return (int) syscall(__NR_io_uring_enter, fd, toSubmit, minComplete, flags, arg, argSize);
+}
+
+
+/*
+    Create the io_uring. Return an error if the kernel lacks support so the caller can fall back to epoll.
+    Requires the single mmap, no-drop and extended wait argument features (Linux 5.11 and later).
+ */
+PUBLIC int mprCreateUring(MprWaitService *ws)
+{
+    struct io_uring_params  params;
+    MprUring                *ring;
+    char                    *mem;
+    uint                    required;
+
+    if ((ring = mprAllocObj(MprUring, manageRing)) == 0) {
+        return MPR_ERR_MEMORY;
+    }
+    memset(&params, 0, sizeof(params));
+    if ((ring->fd = uringSetup(URING_ENTRIES, &params)) < 0) {
+        mprTrace(4, "Cannot create io_uring, errno %d", errno);
+        return MPR_ERR_CANT_INITIALIZE;
+    }
+    required = IORING_FEAT_SINGLE_MMAP | IORING_FEAT_NODROP | IORING_FEAT_EXT_ARG;
+    if ((params.features & required) != required) {
+        termRing(ring);
+        return MPR_ERR_CANT_INITIALIZE;
+    }
+    ring->ringSize = max(params.sq_off.array + params.sq_entries * sizeof(uint),
+        params.cq_off.cqes + params.cq_entries * sizeof(struct io_uring_cqe));
+    mem = mmap(0, ring->ringSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQ_RING);
+    if (mem == MAP_FAILED) {
+        termRing(ring);
+        return MPR_ERR_CANT_INITIALIZE;
+    }
+    ring->ringMem = mem;
+    ring->sqesSize = params.sq_entries * sizeof(struct io_uring_sqe);
+    ring->sqes = mmap(0, ring->sqesSize, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE, ring->fd, IORING_OFF_SQES);
+    if (ring->sqes == MAP_FAILED) {
+        ring->sqes = 0;
+        termRing(ring);
+        return MPR_ERR_CANT_INITIALIZE;
+    }
+    ring->sqEntries = params.sq_entries;
+    ring->sqHead = (uint*) (mem + params.sq_off.head);
+    ring->sqTail = (uint*) (mem + params.sq_off.tail);
+    ring->sqMask = (uint*) (mem + params.sq_off.ring_mask);
+    ring->sqArray = (uint*) (mem + params.sq_off.array);
+    ring->cqHead = (uint*) (mem + params.cq_off.head);
+    ring->cqTail = (uint*) (mem + params.cq_off.tail);
+    ring->cqMask = (uint*) (mem + params.cq_off.ring_mask);
+    ring->cqes = (struct io_uring_cqe*) (mem + params.cq_off.cqes);
+
+    if ((ring->requests = mprCreateList(0, 0)) == 0) {
+        termRing(ring);
+        return MPR_ERR_MEMORY;
+    }
+    ws->ring = ring;
+    armWakeup(ws);
+    if (submit(ring) < 0) {
+        ws->ring = 0;
+        termRing(ring);
+        return MPR_ERR_CANT_INITIALIZE;
+    }
+    mprLog(2, "Using io_uring for I/O notification");
+    return 0;
+}
+
+
+PUBLIC void mprManageUring(MprWaitService *ws, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(ws->ring);
+    }
+}
+
+
+static void manageRing(MprUring *ring, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(ring->requests);
+
+    } else if (flags & MPR_MANAGE_FREE) {
+        termRing(ring);
+    }
+}
+
+
+static void termRing(MprUring *ring)
+{
+    if (ring->sqes) {
+        munmap(ring->sqes, ring->sqesSize);
+        ring->sqes = 0;
+    }
+    if (ring->ringMem) {
+        munmap(ring->ringMem, ring->ringSize);
+        ring->ringMem = 0;
+    }
+    if (ring->fd >= 0) {
+        close(ring->fd);
+        ring->fd = -1;
+    }
+}
+
+
+/*
+    Queue a submission entry. The entry is fully prepared before the tail is advanced so a concurrent io_uring_enter
+    never sees a partial entry. Must be called locked.
+ */
+static int queueSqe(MprUring *ring, int op, int fd, uint64 addr, uint len, uint64 off, uint opflags, uint64 data)
+{
+    struct io_uring_sqe *sqe;
+    uint                tail, index;
+
+    tail = *ring->sqTail;
+    if ((tail - __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE)) >= ring->sqEntries) {
+        /*
+            Submission queue is full. Flush to the kernel to make room.
+         */
+        submit(ring);
+        if ((tail - __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE)) >= ring->sqEntries) {
+            mprError("io_uring submission queue is full");
+            return MPR_ERR_TOO_MANY;
+        }
+    }
+    index = tail & *ring->sqMask;
+    sqe = &ring->sqes[index];
+    memset(sqe, 0, sizeof(*sqe));
+    sqe->opcode = (uchar) op;
+    sqe->fd = fd;
+    sqe->addr = addr;
+    sqe->len = len;
+    sqe->off = off;
+    sqe->rw_flags = (int) opflags;
+    sqe->user_data = data;
+    ring->sqArray[index] = index;
+    __atomic_store_n(ring->sqTail, tail + 1, __ATOMIC_RELEASE);
+    return 0;
+}
+
+
+/*
+    Submit all queued entries to the kernel. Must be called locked.
+ */
+static int submit(MprUring *ring)
+{
+    uint    pending;
+    int     rc;
+
+    pending = *ring->sqTail - __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE);
+    if (pending == 0) {
+        return 0;
+    }
+    if ((rc = uringEnter(ring->fd, pending, 0, 0, NULL, 0)) < 0) {
+        if (errno != EAGAIN && errno != EBUSY && errno != EINTR) {
+            mprError("Cannot submit io_uring requests, errno %d", errno);
+            return MPR_ERR_CANT_WRITE;
+        }
+    }
+    return 0;
+}
+
+
+static void armPoll(MprUring *ring, MprWaitHandler *wp, int mask)
+{
+    uint    events;
+
+    events = 0;
+    if (mask & MPR_READABLE) {
+        events |= POLLIN | POLLHUP;
+    }
+    if (mask & MPR_WRITABLE) {
+        events |= POLLOUT | POLLHUP;
+    }
+    ring->seq = (ring->seq + 1) & URING_SEQ_MASK;
+    if (queueSqe(ring, IORING_OP_POLL_ADD, wp->fd, 0, 0, 0, events, pollData(wp->fd, ring->seq)) == 0) {
+        wp->notifierIndex = ring->seq;
+    }
+}
+
+
+static void armWakeup(MprWaitService *ws)
+{
+    queueSqe(ws->ring, IORING_OP_POLL_ADD, ws->breakFd[MPR_READ_PIPE], 0, 0, 0, POLLIN, URING_WAKE);
+}
+
+
+PUBLIC int mprUringNotifyOn(MprWaitService *ws, MprWaitHandler *wp, int mask)
+{
+    MprUring    *ring;
+    int         fd;
+
+    assert(wp);
+    ring = ws->ring;
+    fd = wp->fd;
+
+    lock(ws);
+    if (wp->desiredMask != mask) {
+        if (wp->notifierIndex >= 0) {
+            queueSqe(ring, IORING_OP_POLL_REMOVE, -1, pollData(fd, wp->notifierIndex), 0, 0, 0, URING_IGNORE);
+            wp->notifierIndex = -1;
+        }
+        if (mask) {
+            armPoll(ring, wp, mask);
+        }
+        wp->desiredMask = mask;
+        if (wp->event) {
+            mprRemoveEvent(wp->event);
+            wp->event = 0;
+        }
+        mprSetItem(ws->handlerMap, fd, mask ? wp : 0);
+        if (!ring->servicing) {
+            submit(ring);
+        }
+    }
+    unlock(ws);
+    return 0;
+}
+
+
+/*
+    Submit an I/O request to the kernel. The request is retained until it completes.
+ */
+PUBLIC int mprUringSubmit(MprWaitService *ws, MprIORequest *req)
+{
+    MprUring    *ring;
+    uint64      data;
+    uint        len;
+    int         op, opflags, rc;
+
+    ring = ws->ring;
+    len = (uint) min(req->size, MAXINT);
+    opflags = 0;
+    switch (req->op) {
+    case MPR_IO_READ:
+        op = IORING_OP_READ;
+        break;
+    case MPR_IO_RECV:
+        op = IORING_OP_RECV;
+        break;
+    case MPR_IO_SEND:
+        op = IORING_OP_SEND;
+        opflags = MSG_NOSIGNAL;
+        break;
+    default:
+        return MPR_ERR_BAD_ARGS;
+    }
+    data = URING_REQUEST | (uint64) (size_t) req;
+
+    lock(ws);
+    if ((rc = queueSqe(ring, op, req->fd, (uint64) (size_t) req->buf, len, (uint64) req->offset, opflags, data)) == 0) {
+        mprAddItem(ring->requests, req);
+        if (!ring->servicing) {
+            rc = submit(ring);
+        }
+    }
+    unlock(ws);
+    return rc;
+}
+
+
+/*
+    Wait for I/O on all registered file descriptors. Timeout is in milliseconds. Pending submissions are flushed
+    in the same system call.
+ */
+PUBLIC void mprUringWaitForIO(MprWaitService *ws, MprTicks timeout)
+{
+    struct io_uring_getevents_arg   arg;
+    struct __kernel_timespec        ts;
+    MprUring                        *ring;
+    uint                            pending;
+    int                             rc;
+
+    ring = ws->ring;
+    if (timeout < 0 || timeout > MAXINT) {
+        timeout = MAXINT;
+    }
+#if BIT_DEBUG
+    if (mprGetDebugMode() && timeout > 30000) {
+        timeout = 30000;
+    }
+#endif
+    if (ws->needRecall) {
+        mprDoWaitRecall(ws);
+        return;
+    }
+    memset(&arg, 0, sizeof(arg));
+    ts.tv_sec = timeout / MPR_TICKS_PER_SEC;
+    ts.tv_nsec = (timeout % MPR_TICKS_PER_SEC) * 1000000;
+    arg.ts = (uint64) (size_t) &ts;
+
+    lock(ws);
+    pending = *ring->sqTail - __atomic_load_n(ring->sqHead, __ATOMIC_ACQUIRE);
+    unlock(ws);
+
+    mprYield(MPR_YIELD_STICKY);
+    if ((rc = uringEnter(ring->fd, pending, 1, IORING_ENTER_GETEVENTS | IORING_ENTER_EXT_ARG, &arg, sizeof(arg))) < 0) {
+        if (errno != EINTR && errno != ETIME) {
+            mprTrace(7, "io_uring_enter returned %d, errno %d", rc, mprGetOsError());
+        }
+    }
+    mprClearWaiting();
+    mprResetYield();
+
+    serviceIO(ws);
+    ws->wakeRequested = 0;
+}
+
+
+/*
+    Process all available completions
+ */
+static void serviceIO(MprWaitService *ws)
+{
+    MprUring            *ring;
+    MprWaitHandler      *wp;
+    MprIORequest        *req;
+    struct io_uring_cqe *cqe;
+    uint64              data;
+    uint                head, tail;
+    int                 fd, mask, res;
+
+    ring = ws->ring;
+    lock(ws);
+    ring->servicing = 1;
+    head = *ring->cqHead;
+    tail = __atomic_load_n(ring->cqTail, __ATOMIC_ACQUIRE);
+
+    for (; head != tail; head++) {
+        cqe = &ring->cqes[head & *ring->cqMask];
+        data = cqe->user_data;
+        res = cqe->res;
+        __atomic_store_n(ring->cqHead, head + 1, __ATOMIC_RELEASE);
+
+        if (data & URING_IGNORE) {
+            continue;
+
+        } else if (data & URING_WAKE) {
+            char buf[16];
+            if (read(ws->breakFd[MPR_READ_PIPE], buf, sizeof(buf)) < 0) {}
+            armWakeup(ws);
+            continue;
+
+        } else if (data & URING_REQUEST) {
+            req = (MprIORequest*) (size_t) (data & ~URING_TAGS);
+            mprRemoveItem(ring->requests, req);
+            if (res < 0) {
+                req->error = -res;
+                req->result = -1;
+            } else {
+                req->result = res;
+            }
+            mprCompleteIO(req);
+            continue;
+        }
+        fd = (int) (data & 0xFFFFFFFF);
+        if ((wp = mprGetItem(ws->handlerMap, fd)) == 0 || wp->notifierIndex != (int) (data >> 32)) {
+            /*
+                Completion for a poll request that has since been removed or replaced
+             */
+            continue;
+        }
+        /*
+            Poll requests are one-shot. The request is now complete.
+         */
+        wp->notifierIndex = -1;
+        mask = 0;
+        if (res < 0) {
+            /* Let the handler discover the error */
+            mask = wp->desiredMask;
+        } else {
+            if (res & (POLLIN | POLLERR | POLLHUP)) {
+                mask |= MPR_READABLE;
+            }
+            if (res & (POLLOUT | POLLERR | POLLHUP)) {
+                mask |= MPR_WRITABLE;
+            }
+        }
+        wp->presentMask = mask & wp->desiredMask;
+
+        if (wp->presentMask) {
+            if (wp->flags & MPR_WAIT_IMMEDIATE) {
+                (wp->proc)(wp->handlerData, NULL);
+                if (wp->fd >= 0 && wp->desiredMask && wp->notifierIndex < 0) {
+                    armPoll(ring, wp, wp->desiredMask);
+                }
+            } else {
+                /*
+                    Suppress further events while this event is being serviced. User must re-enable.
+                 */
+                mprNotifyOn(ws, wp, 0);
+                mprQueueIOEvent(wp);
+            }
+        } else if (wp->desiredMask) {
+            armPoll(ring, wp, wp->desiredMask);
+        }
+    }
+    ring->servicing = 0;
+    submit(ring);
+    unlock(ws);
+}
+
+#else
+PUBLIC void stubMprUring() {}
+#endif /* MPR_EVENT_IO_URING */
+
+/*
+    @copy   default
+
+    Copyright (c) Embedthis Software LLC, 2003-2013. All Rights Reserved.
+
+    This software is distributed under commercial and open source licenses.
+    You may use the Embedthis Open Source license or you may acquire a
+    commercial license from Embedthis Software. You agree to be fully bound
+    by the terms of either license. Consult the LICENSE.md distributed with
+    this software for full details and other copyrights.
+
+    Local variables:
+    tab-width: 4
+    c-basic-offset: 4
+    End:
+    vim: sw=4 ts=4 expandtab
+
+    @end
+ */
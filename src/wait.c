@@ -15,9 +15,13 @@
 
 /***************************** Forward Declarations ***************************/
 
+static void ioCompleteEvent(MprIORequest *req, MprEvent *event);
 static void ioEvent(void *data, MprEvent *event);
+static void manageIORequest(MprIORequest *req, int flags);
 static void manageWaitService(MprWaitService *ws, int flags);
 static void manageWaitHandler(MprWaitHandler *wp, int flags);
+static void queueRecall(MprWaitService *ws, MprWaitHandler *wp);
+static void dequeueRecall(MprWaitService *ws, MprWaitHandler *wp);
 
 /************************************ Code ************************************/
 /*
@@ -78,7 +82,7 @@ static MprWaitHandler *initWaitHandler(MprWaitHandler *wp, int fd, int mask, Mpr
     wp->flags           = 0;
     wp->handlerData     = data;
     wp->service         = ws;
-    wp->flags           = flags;
+    wp->flags           = flags & ~MPR_WAIT_RECALL_HANDLER;
 
     if (mprGetListLength(ws->handlers) >= FD_SETSIZE) {
         mprTrace(6, "io: Too many io handlers: %d", FD_SETSIZE);
@@ -155,6 +159,9 @@ PUBLIC void mprRemoveWaitHandler(MprWaitHandler *wp)
             wp->event = 0;
         }
     }
+    if (wp->flags & MPR_WAIT_RECALL_HANDLER) {
+        dequeueRecall(ws, wp);
+    }
     unlock(ws);
 }
 
@@ -202,6 +209,43 @@ PUBLIC void mprWaitOn(MprWaitHandler *wp, int mask)
 }
 
 
+/*
+    Add a handler to the recall queue. The queue holds only handlers with MPR_WAIT_RECALL_HANDLER set so that
+    recalls are serviced without scanning all handlers. Must be called locked.
+ */
+static void queueRecall(MprWaitService *ws, MprWaitHandler *wp)
+{
+    if (!(wp->flags & MPR_WAIT_RECALL_HANDLER)) {
+        wp->flags |= MPR_WAIT_RECALL_HANDLER;
+        wp->prev = 0;
+        wp->next = ws->recallq;
+        if (ws->recallq) {
+            ws->recallq->prev = wp;
+        }
+        ws->recallq = wp;
+    }
+    ws->needRecall = 1;
+}
+
+
+/*
+    Must be called locked
+ */
+static void dequeueRecall(MprWaitService *ws, MprWaitHandler *wp)
+{
+    if (wp->prev) {
+        wp->prev->next = wp->next;
+    } else {
+        ws->recallq = wp->next;
+    }
+    if (wp->next) {
+        wp->next->prev = wp->prev;
+    }
+    wp->next = wp->prev = 0;
+    wp->flags &= ~MPR_WAIT_RECALL_HANDLER;
+}
+
+
 /*
     Set a handler to be recalled without further I/O
  */
@@ -213,14 +257,21 @@ PUBLIC void mprRecallWaitHandlerByFd(Socket fd)
 
     ws = MPR->waitService;
     lock(ws);
-    for (index = 0; (wp = (MprWaitHandler*) mprGetNextItem(ws->handlers, &index)) != 0; ) {
-        if (wp->fd == fd) {
-            wp->flags |= MPR_WAIT_RECALL_HANDLER;
-            ws->needRecall = 1;
-            mprWakeEventService();
-            break;
+    wp = ws->handlerMap ? mprGetItem(ws->handlerMap, (int) fd) : 0;
+    if (wp == 0 || wp->fd != fd) {
+        /*
+            The handler map only holds handlers with a non-zero desired mask
+         */
+        for (index = 0; (wp = (MprWaitHandler*) mprGetNextItem(ws->handlers, &index)) != 0; ) {
+            if (wp->fd == fd) {
+                break;
+            }
         }
     }
+    if (wp) {
+        queueRecall(ws, wp);
+        mprWakeEventService();
+    }
     unlock(ws);
 }
 
@@ -232,9 +283,10 @@ PUBLIC void mprRecallWaitHandler(MprWaitHandler *wp)
     if (wp) {
         ws = MPR->waitService;
         lock(ws);
-        wp->flags |= MPR_WAIT_RECALL_HANDLER;
-        ws->needRecall = 1;
-        mprWakeEventService();
+        if (wp->fd >= 0) {
+            queueRecall(ws, wp);
+            mprWakeEventService();
+        }
         unlock(ws);
     }
 }
@@ -242,18 +294,19 @@ PUBLIC void mprRecallWaitHandler(MprWaitHandler *wp)
 
 /*
     Recall a handler which may have buffered data. Only called by notifiers.
+    Handlers that are not currently waiting for read events remain on the recall queue.
  */
 PUBLIC void mprDoWaitRecall(MprWaitService *ws)
 {
-    MprWaitHandler      *wp;
-    int                 index;
+    MprWaitHandler      *wp, *next;
 
     lock(ws);
     ws->needRecall = 0;
-    for (index = 0; (wp = (MprWaitHandler*) mprGetNextItem(ws->handlers, &index)) != 0; ) {
-        if ((wp->flags & MPR_WAIT_RECALL_HANDLER) && (wp->desiredMask & MPR_READABLE)) {
+    for (wp = ws->recallq; wp; wp = next) {
+        next = wp->next;
+        if (wp->desiredMask & MPR_READABLE) {
+            dequeueRecall(ws, wp);
             wp->presentMask |= MPR_READABLE;
-            wp->flags &= ~MPR_WAIT_RECALL_HANDLER;
             mprNotifyOn(ws, wp, 0);
             mprQueueIOEvent(wp);
         }
@@ -262,6 +315,107 @@ PUBLIC void mprDoWaitRecall(MprWaitService *ws)
 }
 
 
+/*
+    Submit an I/O request. If the notifier supports asynchronous I/O (io_uring), the request is submitted to the kernel.
+    Otherwise the I/O is performed now and the completion is queued on the dispatcher.
+ */
+PUBLIC MprIORequest *mprSubmitIO(int op, int fd, void *buf, ssize size, MprOff offset, MprDispatcher *dispatcher, 
+    void *proc, void *data)
+{
+    MprIORequest    *req;
+    ssize           rc;
+
+    assert(fd >= 0);
+    assert(buf);
+    assert(proc);
+
+    if ((req = mprAllocObj(MprIORequest, manageIORequest)) == 0) {
+        return 0;
+    }
+    req->op = op;
+    req->fd = fd;
+    req->buf = buf;
+    req->size = size;
+    req->offset = offset;
+    req->proc = proc;
+    req->data = data;
+    req->dispatcher = dispatcher ? dispatcher : MPR->dispatcher;
+
+#if MPR_EVENT_IO_URING
+    if (MPR->waitService->ring) {
+        if (mprUringSubmit(MPR->waitService, req) < 0) {
+            return 0;
+        }
+        return req;
+    }
+#endif
+    switch (op) {
+    case MPR_IO_READ:
+#if BIT_UNIX_LIKE
+        rc = (offset >= 0) ? pread(fd, buf, size, offset) : read(fd, buf, size);
+#else
+        if (offset >= 0 && lseek(fd, (long) offset, SEEK_SET) < 0) {
+            rc = -1;
+        } else {
+            rc = read(fd, buf, (uint) size);
+        }
+#endif
+        break;
+    case MPR_IO_RECV:
+        rc = recv(fd, buf, (int) size, MSG_NOSIGNAL);
+        break;
+    case MPR_IO_SEND:
+        rc = send(fd, buf, (int) size, MSG_NOSIGNAL);
+        break;
+    default:
+        return 0;
+    }
+    if (rc < 0) {
+        req->error = mprGetOsError();
+        req->result = -1;
+    } else {
+        req->result = rc;
+    }
+    mprCompleteIO(req);
+    return req;
+}
+
+
+/*
+    Queue the completion callback for an I/O request on its dispatcher
+ */
+PUBLIC void mprCompleteIO(MprIORequest *req)
+{
+    mprCreateEvent(req->dispatcher, "IOComplete", 0, ioCompleteEvent, req, 0);
+}
+
+
+static void ioCompleteEvent(MprIORequest *req, MprEvent *event)
+{
+    (req->proc)(req->data, req);
+}
+
+
+static void manageIORequest(MprIORequest *req, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(req->buf);
+        mprMark(req->data);
+        mprMark(req->dispatcher);
+    }
+}
+
+
+PUBLIC bool mprHasAsyncIO()
+{
+#if MPR_EVENT_IO_URING
+    return MPR->waitService->ring != 0;
+#else
+    return 0;
+#endif
+}
+
+
 /*
     @copy   default
 
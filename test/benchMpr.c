@@ -14,22 +14,43 @@ typedef struct App {
     int      testAllocOnly;     /* Test alloc only  */
     int      iterations;        /* Benchmark iterations */
     int      workers;           /* Number of worker threads */
+    int      heap;              /* Megabytes of heap to retain while spawning commands */
+    MprList  *retain;           /* Retained heap blocks */
     MprCond  *complete;         /* Condition set when benchmark complete */
     MprMutex *mutex;            /* Test synchronization */
     int      markCount;         /* Flag set when benchmark complete */
+    volatile int finished;      /* Count of completed worker events */
+    MprList  *dispatchers;      /* Dispatchers for the worker benchmark */
+    MprHash  *table;            /* Hash table for the lookup benchmark */
+    MprList  *keys;             /* Keys for the lookup benchmark */
+    int      lookups;           /* Lookups per thread */
+    int      serialize;         /* Serialize lookups with app->mutex */
 } App;
 
 static App *app;
 
 /***************************** Forward Declarations ***************************/
 
+#if BIT_UNIX_LIKE
+static void     acceptRounds(MprSocket *listen, struct sockaddr_in *sa, int rounds, int batch);
+static MprSocket *connectLoopback(int *fd);
+static void     sendRound(MprSocket *sp, int fd, int mode, MprOff total);
+#endif
 static void     doBenchmark(void *thread);
 static void     endMark(MprTime start, int count, char *msg);
 static void     eventCallback(void *data, MprEvent *ep);
+static void     lookupProc(void *data, MprThread *tp);
 static void     manageApp(App *app, int flags);
+static void     testAccept();
+static void     testCmd();
+static void     testLookups();
 static MprTime  startMark();
 static void     testMalloc();
+static void     testSendFile();
+static void     testSendPaths();
+static void     testWorkers();
 static void     timerCallback(void *data, MprEvent *ep);
+static void     workerCallback(void *data, MprEvent *ep);
 volatile int    testComplete;
 
 /*********************************** Code *************************************/
@@ -67,6 +88,20 @@ MAIN(benchMpr, int argc, char **argv, char **envp)
 
         } else if (strcmp(argp, "--alloc") == 0 || strcmp(argp, "-a") == 0) {
             app->testAllocOnly++;
+
+        } else if (strcmp(argp, "--workers") == 0 || strcmp(argp, "-t") == 0) {
+            if (nextArg >= argc) {
+                err++;
+            } else {
+                app->workers = atoi(argv[++nextArg]);
+            }
+
+        } else if (strcmp(argp, "--heap") == 0) {
+            if (nextArg >= argc) {
+                err++;
+            } else {
+                app->heap = atoi(argv[++nextArg]);
+            }
         } else {
             err++;
         }
@@ -75,6 +110,7 @@ MAIN(benchMpr, int argc, char **argv, char **envp)
         mprPrintf("usage: bench [-a] [-i iterations] [-t workers]\n");
         mprRawLog(0, "usage: %s [options]\n"
             "    -a                  # Alloc test only\n"
+            "    --heap megabytes    # Heap to retain when spawning commands\n"
             "    --iterations count  # Number of iterations to run the test\n"
             "    --workers count     # Set maximum worker threads\n",
             mprGetAppName(mpr));
@@ -98,6 +134,10 @@ static void manageApp(App *app, int flags)
     if (flags & MPR_MANAGE_MARK) {
         mprMark(app->complete);
         mprMark(app->mutex);
+        mprMark(app->retain);
+        mprMark(app->dispatchers);
+        mprMark(app->table);
+        mprMark(app->keys);
     }
 }
 
@@ -199,6 +239,12 @@ static void doBenchmark(void *thread)
         mprWaitForCond(app->complete, -1);
         endMark(start, count, "Timer (create|delete)");
 
+        testWorkers();
+        testLookups();
+        testAccept();
+        testSendPaths();
+        testSendFile();
+
         /*
             Alloc (1K)
          */
@@ -212,6 +258,8 @@ static void doBenchmark(void *thread)
             }
         }
         endMark(start, count, "Alloc mprAlloc(1K)");
+
+        testCmd();
     }
     testComplete = 1;
 }
@@ -359,6 +407,525 @@ static void testMalloc()
 }
 
 
+/*
+    Run tiny events on many dispatchers to measure worker scheduling. Uses --workers workers (default 32).
+ */
+static void testWorkers()
+{
+    MprWorkerStats  stats;
+    MprTime         start;
+    int             count, i, workers, ndispatchers;
+
+    mprPrintf("Worker Benchmarks\n");
+    workers = app->workers > 0 ? app->workers : 32;
+    mprSetMaxWorkers(workers);
+    ndispatchers = workers * 2;
+    app->dispatchers = mprCreateList(ndispatchers, 0);
+    for (i = 0; i < ndispatchers; i++) {
+        mprAddItem(app->dispatchers, mprCreateDispatcher("workerBenchmark", 0));
+    }
+    count = 2000000 * app->iterations;
+    app->finished = 0;
+    start = startMark();
+    for (i = 0; i < count; i++) {
+        mprCreateEvent(mprGetItem(app->dispatchers, i % ndispatchers), "workerBenchmark", 0, workerCallback, 0, 0);
+        if ((i % 1024) == 0) {
+            /* Permit GC */
+            mprYield(0);
+        }
+    }
+    while (app->finished < count) {
+        mprNap(1);
+    }
+    endMark(start, count, "Worker event (create|run)");
+    mprGetWorkerStats(&stats);
+    mprPrintf("\tWorkers %d, max used %d, stolen tasks %d\n", workers, stats.maxUsed, stats.steals);
+    for (i = 0; i < ndispatchers; i++) {
+        mprDestroyDispatcher(mprGetItem(app->dispatchers, i));
+    }
+    app->dispatchers = 0;
+}
+
+
+static void workerCallback(void *data, MprEvent *event)
+{
+    mprAtomicAdd(&app->finished, 1);
+}
+
+
+/*
+    Hash lookups from 1 to 32 threads. Compares lookups serialized by a mutex with the reader-writer lock
+    and with the per-cpu reader-writer lock used for read-mostly tables.
+ */
+static void testLookups()
+{
+    MprThread   *tp;
+    MprTime     start;
+    char        msg[80];
+    int         count, i, mode, threads, flags;
+
+    mprPrintf("Lookup Benchmarks\n");
+    app->keys = mprCreateList(0, 0);
+    for (i = 0; i < 500; i++) {
+        mprAddItem(app->keys, sfmt("key-%d", i));
+    }
+    for (mode = 0; mode < 3; mode++) {
+        flags = (mode == 0) ? MPR_HASH_OWN : (mode == 1) ? 0 : MPR_HASH_READ_MOSTLY;
+        app->serialize = (mode == 0);
+        app->table = mprCreateHash(0, flags | MPR_HASH_STATIC_VALUES);
+        for (i = 0; i < mprGetListLength(app->keys); i++) {
+            mprAddKey(app->table, mprGetItem(app->keys, i), ITOP(i));
+        }
+        for (threads = 1; threads <= 32; threads *= 32) {
+            count = 1000000 * app->iterations;
+            app->lookups = count / threads;
+            app->finished = 0;
+            start = startMark();
+            for (i = 0; i < threads; i++) {
+                tp = mprCreateThread("lookup", lookupProc, NULL, 0);
+                mprStartThread(tp);
+            }
+            while (app->finished < threads) {
+                mprNap(1);
+            }
+            fmt(msg, sizeof(msg), "Lookup %s x%d", (mode == 0) ? "mutex" : (mode == 1) ? "rwlock" : "percpu", threads);
+            endMark(start, app->lookups * threads, msg);
+        }
+        app->table = 0;
+    }
+    app->keys = 0;
+}
+
+
+static void lookupProc(void *data, MprThread *tp)
+{
+    int     i, nkeys;
+
+    nkeys = mprGetListLength(app->keys);
+    for (i = 0; i < app->lookups; i++) {
+        if (app->serialize) {
+            mprLock(app->mutex);
+            mprLookupKey(app->table, mprGetItem(app->keys, i % nkeys));
+            mprUnlock(app->mutex);
+        } else {
+            mprLookupKey(app->table, mprGetItem(app->keys, i % nkeys));
+        }
+        if ((i % 1024) == 0) {
+            /* Permit GC */
+            mprYield(0);
+        }
+    }
+    mprAtomicAdd(&app->finished, 1);
+}
+
+
+/*
+    Loopback connections accepted one at a time and in batches. Clients reset on close to avoid TIME_WAIT.
+ */
+static void testAccept()
+{
+#if BIT_UNIX_LIKE
+    MprSocket           *listen;
+    MprTime             start;
+    struct sockaddr_in  sa;
+    int                 batch, port, rounds;
+
+    mprPrintf("Accept Benchmarks\n");
+    listen = mprCreateSocket();
+    for (port = 9450; port < 9550; port++) {
+        if (mprListenOnSocket(listen, "127.0.0.1", port, 0) != SOCKET_ERROR) {
+            break;
+        }
+    }
+    if (port >= 9550) {
+        mprPrintf("\tCannot listen for accept benchmark\n");
+        return;
+    }
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_port = htons(port);
+    sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    rounds = 20 * app->iterations;
+
+    /* Warm up */
+    acceptRounds(listen, &sa, rounds, 0);
+    mprRequestGC(MPR_GC_FORCE | MPR_GC_COMPLETE);
+    for (batch = 0; batch < 2; batch++) {
+        start = startMark();
+        acceptRounds(listen, &sa, rounds, batch);
+        endMark(start, rounds * 64, batch ? "Accept batch (connect|close)" : "Accept single (connect|close)");
+    }
+    mprCloseSocket(listen, 0);
+#endif
+}
+
+
+#if BIT_UNIX_LIKE
+static void acceptRounds(MprSocket *listen, struct sockaddr_in *sa, int rounds, int batch)
+{
+    MprSocket       *sockets[64];
+    struct linger   linger;
+    int             fds[64], count, i, j, n;
+
+    linger.l_onoff = 1;
+    linger.l_linger = 0;
+    for (i = 0; i < rounds; i++) {
+        for (j = 0; j < 64; j++) {
+            fds[j] = socket(AF_INET, SOCK_STREAM, 0);
+            setsockopt(fds[j], SOL_SOCKET, SO_LINGER, (char*) &linger, sizeof(linger));
+            connect(fds[j], (struct sockaddr*) sa, sizeof(*sa));
+        }
+        for (count = 0; count < 64; count += n) {
+            if (batch) {
+                n = mprAcceptSockets(listen, &sockets[count], 64 - count);
+            } else {
+                n = ((sockets[count] = mprAcceptSocket(listen)) != 0);
+            }
+            if (n == 0) {
+                break;
+            }
+        }
+        for (j = 0; j < count; j++) {
+            mprCloseSocket(sockets[j], 0);
+        }
+        for (j = 0; j < 64; j++) {
+            close(fds[j]);
+        }
+    }
+}
+#endif
+
+
+/*
+    Send paths over loopback. Reports process CPU time (user + system) in milliseconds per GB sent. The receiver discards
+    data with MSG_TRUNC so the figures are dominated by the sender. Note that loopback delivery copies MSG_ZEROCOPY pages
+    into the receiving socket, so only the pipe forwarding case avoids a copy on loopback.
+ */
+static void testSendPaths()
+{
+#if BIT_UNIX_LIKE
+    MprSocket   *sp;
+    MprOff      total;
+    int         fd, mode;
+
+    mprPrintf("Send Path Benchmarks (CPU msec per GB)\n");
+    if ((sp = connectLoopback(&fd)) == 0) {
+        mprPrintf("\tCannot connect for send benchmark\n");
+        return;
+    }
+    mprAddRoot(sp);
+    total = (MprOff) 1024 * 1024 * 1024 * app->iterations;
+    for (mode = 0; mode < 4; mode++) {
+        sendRound(sp, fd, mode, total);
+    }
+    mprRemoveRoot(sp);
+    mprCloseSocket(sp, 0);
+    close(fd);
+#endif
+}
+
+
+#if BIT_UNIX_LIKE
+/*
+    Open a loopback connection. Returns the accepted MPR socket and the raw client descriptor in *fd.
+ */
+static MprSocket *connectLoopback(int *fd)
+{
+    MprSocket           *listen, *sp;
+    MprTicks            mark;
+    struct sockaddr_in  sa;
+    int                 port;
+
+    listen = mprCreateSocket();
+    for (port = 9450; port < 9550; port++) {
+        if (mprListenOnSocket(listen, "127.0.0.1", port, 0) != SOCKET_ERROR) {
+            break;
+        }
+    }
+    if (port >= 9550) {
+        return 0;
+    }
+    memset(&sa, 0, sizeof(sa));
+    sa.sin_family = AF_INET;
+    sa.sin_port = htons(port);
+    sa.sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    *fd = socket(AF_INET, SOCK_STREAM, 0);
+    if (connect(*fd, (struct sockaddr*) &sa, sizeof(sa)) < 0) {
+        mprCloseSocket(listen, 0);
+        close(*fd);
+        return 0;
+    }
+    mark = mprGetTicks();
+    while ((sp = mprAcceptSocket(listen)) == 0 && mprGetElapsedTicks(mark) < MPR_TEST_TIMEOUT) {
+        mprSleep(1);
+    }
+    mprCloseSocket(listen, 0);
+    if (sp == 0) {
+        close(*fd);
+    }
+    return sp;
+}
+#endif
+
+
+#if BIT_UNIX_LIKE
+static void sendRound(MprSocket *sp, int fd, int mode, MprOff total)
+{
+    static char     buf[64 * 1024], tmp[64 * 1024];
+    static char     *names[] = { "Send write (copy)", "Send MSG_ZEROCOPY", "Pipe read|write", "Pipe splice" };
+    struct rusage   before, after;
+    MprTime         start;
+    MprOff          sent;
+    ssize           nbytes, pending, rc, sofar;
+    double          cpu;
+    int             i, pfd[2];
+
+    if (pipe(pfd) < 0) {
+        return;
+    }
+    fcntl(pfd[0], F_SETFL, fcntl(pfd[0], F_GETFL) | O_NONBLOCK);
+#if defined(F_SETPIPE_SZ)
+    fcntl(pfd[0], F_SETPIPE_SZ, 1024 * 1024);
+#endif
+    pending = 0;
+    getrusage(RUSAGE_SELF, &before);
+    start = mprGetTime();
+
+    for (sent = 0; sent < total; ) {
+        rc = 0;
+        if (mode == 0) {
+            rc = mprWriteSocket(sp, buf, sizeof(buf));
+
+        } else if (mode == 1) {
+            rc = mprWriteSocketZeroCopy(sp, buf, sizeof(buf), NULL, NULL);
+
+        } else {
+            /* The producer writes into the pipe as a command would */
+            if (pending == 0) {
+                for (i = 0; i < 16; i++) {
+                    pending += write(pfd[1], buf, sizeof(buf));
+                }
+            }
+            if (mode == 2) {
+                if ((nbytes = read(pfd[0], tmp, min(pending, (ssize) sizeof(tmp)))) > 0) {
+                    for (sofar = 0; sofar < nbytes; ) {
+                        if ((rc = mprWriteSocket(sp, &tmp[sofar], nbytes - sofar)) > 0) {
+                            sofar += rc;
+                        } else {
+                            while (recv(fd, NULL, 1024 * 1024, MSG_TRUNC | MSG_DONTWAIT) > 0) { }
+                        }
+                    }
+                    rc = nbytes;
+                }
+            } else {
+                rc = mprSpliceToSocket(sp, pfd[0], pending, 0);
+            }
+            if (rc > 0) {
+                pending -= rc;
+            }
+        }
+        if (rc > 0) {
+            sent += rc;
+        }
+        while (recv(fd, NULL, 1024 * 1024, MSG_TRUNC | MSG_DONTWAIT) > 0) { }
+    }
+    getrusage(RUSAGE_SELF, &after);
+    cpu = (after.ru_utime.tv_sec - before.ru_utime.tv_sec + after.ru_stime.tv_sec - before.ru_stime.tv_sec) * 1000.0 +
+          (after.ru_utime.tv_usec - before.ru_utime.tv_usec + after.ru_stime.tv_usec - before.ru_stime.tv_usec) / 1000.0;
+    mprPrintf("\t%-30s\t%13.2f\t%12.2f\n", names[mode], cpu * (1024.0 * 1024 * 1024) / sent, 
+        mprGetElapsedTime(start) / 1000.0);
+    close(pfd[0]);
+    close(pfd[1]);
+    mprRequestGC(MPR_GC_FORCE | MPR_GC_COMPLETE);
+}
+#endif
+
+
+#if LINUX
+/*
+    The glibc tcp_info stops short of the segment counters. These follow it in the kernel structure.
+ */
+typedef struct TcpInfo {
+    struct tcp_info info;
+    uint64          pacingRate;
+    uint64          maxPacingRate;
+    uint64          bytesAcked;
+    uint64          bytesReceived;
+    uint            segsOut;
+    uint            segsIn;
+} TcpInfo;
+
+
+static int64 getSegmentsOut(int fd)
+{
+    TcpInfo     ti;
+    socklen_t   len;
+
+    memset(&ti, 0, sizeof(ti));
+    len = sizeof(ti);
+    if (getsockopt(fd, IPPROTO_TCP, TCP_INFO, &ti, &len) < 0 || len < sizeof(ti)) {
+        return -1;
+    }
+    return ti.segsOut;
+}
+
+
+/*
+    Write system calls made by this thread
+ */
+static int64 getWriteCalls()
+{
+    char    buf[512], *cp;
+    ssize   len;
+    int     fd;
+
+    if ((fd = open("/proc/thread-self/io", O_RDONLY)) < 0) {
+        return -1;
+    }
+    len = read(fd, buf, sizeof(buf) - 1);
+    close(fd);
+    buf[max(len, 0)] = '\0';
+    if ((cp = strstr(buf, "syscw:")) == 0) {
+        return -1;
+    }
+    return stoi(&cp[6]);
+}
+
+
+/*
+    Responses of headers, a file body and a chunk trailer over loopback. Reports TCP segments, write system calls and
+    elapsed time per response. The separate case issues writev, sendfile and writev as mprSendFileToSocket did before
+    corking and combined small writes. The server socket uses TCP_NODELAY as a web server would. The setsockopt calls
+    used for corking are not counted as writes.
+ */
+static void testSendFile()
+{
+    MprSocket   *sp;
+    MprFile     *file;
+    MprTime     start;
+    MprIOVec    before[2], after[1];
+    MprOff      total;
+    off_t       off;
+    int64       segs, writes;
+    ssize       rc, received;
+    char        name[80];
+    int         count, fd, i, mode, n, size, sizes[] = { 512, 4096, 32768 };
+
+    static char buf[32768];
+    static char *modes[] = { "Separate", "Send file" };
+
+    mprPrintf("Send File Benchmarks (per response)\n");
+    if ((sp = connectLoopback(&fd)) == 0) {
+        mprPrintf("\tCannot connect for send file benchmark\n");
+        return;
+    }
+    mprAddRoot(sp);
+    mprSetSocketBlockingMode(sp, 1);
+    mprSetSocketNoDelay(sp, 1);
+    if ((file = mprOpenFile(mprGetTempPath(NULL), O_CREAT | O_TRUNC | O_RDWR | O_BINARY, 0644)) == 0) {
+        mprRemoveRoot(sp);
+        mprCloseSocket(sp, 0);
+        close(fd);
+        return;
+    }
+    mprAddRoot(file);
+    memset(buf, 'x', sizeof(buf));
+    mprWriteFile(file, buf, sizeof(buf));
+
+    before[0].start = "HTTP/1.1 200 OK\r\nContent-Type: text/html\r\nTransfer-Encoding: chunked\r\n\r\n";
+    before[0].len = slen(before[0].start);
+    after[0].start = "\r\n0\r\n\r\n";
+    after[0].len = slen(after[0].start);
+    count = 2000 * app->iterations;
+
+    for (i = 0; i < (int) (sizeof(sizes) / sizeof(int)); i++) {
+        size = sizes[i];
+        before[1].start = sfmt("%x\r\n", size);
+        before[1].len = slen(before[1].start);
+        mprHold(before[1].start);
+        total = before[0].len + before[1].len + size + after[0].len;
+
+        for (mode = 0; mode < 2; mode++) {
+            segs = getSegmentsOut(sp->fd);
+            writes = getWriteCalls();
+            start = mprGetTime();
+            for (n = 0; n < count; n++) {
+                if (mode == 0) {
+                    off = 0;
+                    rc = writev(sp->fd, (const struct iovec*) before, 2);
+                    rc += sendfile(sp->fd, file->fd, &off, size);
+                    rc += writev(sp->fd, (const struct iovec*) after, 1);
+                } else {
+                    rc = (ssize) mprSendFileToSocket(sp, file, 0, total, before, 2, after, 1);
+                }
+                if (rc != total) {
+                    mprPrintf("\tShort send file write\n");
+                    break;
+                }
+                for (received = 0; received < total; received += rc) {
+                    if ((rc = recv(fd, NULL, (size_t) total, MSG_TRUNC)) <= 0) {
+                        break;
+                    }
+                }
+            }
+            fmt(name, sizeof(name), "%s (%d)", modes[mode], size);
+            mprPrintf("\t%-30s\t%8.2f segs\t%8.2f writes\t%8.2f usec\n", name,
+                segs < 0 ? -1.0 : (double) (getSegmentsOut(sp->fd) - segs) / count,
+                writes < 0 ? -1.0 : (double) (getWriteCalls() - writes) / count,
+                mprGetElapsedTime(start) * 1000.0 / count);
+        }
+        mprRelease(before[1].start);
+    }
+    mprDeletePath(file->path);
+    mprCloseFile(file);
+    mprRemoveRoot(file);
+    mprRemoveRoot(sp);
+    mprCloseSocket(sp, 0);
+    close(fd);
+    mprRequestGC(MPR_GC_FORCE | MPR_GC_COMPLETE);
+}
+#else
+static void testSendFile() {}
+#endif
+
+
+/*
+    Command spawning. Use --heap to measure the cost of starting commands from a process with a large heap.
+ */
+static void testCmd()
+{
+    MprTime     start;
+    MprCmd      *cmd;
+    char        *ptr;
+    int         count, i, status;
+
+    mprPrintf("Cmd Benchmarks\n");
+    if (app->heap > 0) {
+        app->retain = mprCreateList(app->heap, 0);
+        for (i = 0; i < app->heap; i++) {
+            /* Touch the pages so they are resident */
+            ptr = mprAlloc(1024 * 1024);
+            memset(ptr, i, 1024 * 1024);
+            mprAddItem(app->retain, ptr);
+        }
+        mprPrintf("\tRetaining %d MB heap\n", app->heap);
+    }
+    count = 2000 * app->iterations;
+    start = startMark();
+    for (i = 0; i < count; i++) {
+        cmd = mprCreateCmd(NULL);
+        status = mprRunCmd(cmd, "/bin/true", NULL, NULL, NULL, -1, 0);
+        mprDestroyCmd(cmd);
+        if (status != 0) {
+            mprPrintf("\tCannot run /bin/true\n");
+            break;
+        }
+    }
+    endMark(start, count, "Cmd run /bin/true");
+    app->retain = 0;
+}
+
+
 /*
     Event callback 
  */
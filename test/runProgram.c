@@ -18,6 +18,7 @@
 
 #include <stdio.h>
 #include <stdlib.h>
+#include <string.h>
 
 #if BIT_UNIX_LIKE
 #include <signal.h>
@@ -89,8 +90,12 @@ int main(int argc, char* argv[])
      */
     sofar = 0;
     while ((len = (int) read(0, buf, sizeof(buf))) > 0) {
-        sofar += (int) write(1, buf, len);
         buf[len] = '\0';
+        if (exitCode == 99 && strstr(buf, "\nexit") != 0) {
+            /* Command pool helper asked to exit without responding */
+            return 1;
+        }
+        sofar += (int) write(1, buf, len);
     }
     if (exitCode != 99) {
         printf("END\n");
@@ -14,6 +14,8 @@ typedef struct TestCmd {
     MprCmd  *cmd;
     MprBuf  *buf;
     char    *program;
+    MprCmdPool *pool;
+    int     completed;
 } TestCmd;
 
 static void manageTestCmd(TestCmd *tc, int flags);
@@ -36,6 +38,7 @@ static void manageTestCmd(TestCmd *tc, int flags)
         mprMark(tc->cmd);
         mprMark(tc->buf);
         mprMark(tc->program);
+        mprMark(tc->pool);
     }
 }
 
@@ -317,6 +320,79 @@ static void testMultiple(MprTestGroup *gp)
 }
 
 
+#if BIT_UNIX_LIKE
+static void poolCallback(MprCmdPool *pool, int status, cchar *response, ssize len, MprTestGroup *gp)
+{
+    TestCmd     *tc;
+
+    tc = gp->data;
+    tassert(status == 0);
+    tassert(smatch(response, "data"));
+    tc->completed++;
+}
+
+
+static void testCmdPool(MprTestGroup *gp)
+{
+    TestCmd     *tc;
+    char        *response, command[BIT_MAX_PATH];
+    int         i, status, accepted;
+
+    tc = gp->data;
+
+    /*
+        runProgram with 99 echos stdin to stdout. A request frame is thus echoed back as a valid response frame.
+     */
+    fmt(command, sizeof(command), "%s 99", tc->program);
+    tc->pool = mprCreateCmdPool(command, 2, 4, gp->dispatcher);
+    tassert(tc->pool != 0);
+    if (tc->pool == 0) {
+        return;
+    }
+    status = mprRunCmdPool(tc->pool, "hello world", -1, &response, MPR_TEST_SLEEP);
+    tassert(status == 0);
+    tassert(smatch(response, "hello world"));
+
+    status = mprRunCmdPool(tc->pool, "", 0, &response, MPR_TEST_SLEEP);
+    tassert(status == 0);
+    tassert(response && *response == '\0');
+
+    /*
+        Back-pressure: requests beyond the queue limit are rejected
+     */
+    tc->completed = 0;
+    for (i = accepted = 0; i < 8; i++) {
+        if (mprSubmitCmdPool(tc->pool, "data", -1, (MprCmdPoolProc) poolCallback, gp) == 0) {
+            accepted++;
+        }
+    }
+    /* Requests are assigned to helpers on the pool dispatcher, which is busy running this test */
+    tassert(accepted == 4);
+    for (i = 0; i < 100 && tc->completed < accepted; i++) {
+        mprWaitForEvent(gp->dispatcher, 50);
+    }
+    tassert(tc->completed == accepted);
+
+    /*
+        A helper that exits fails its request and is restarted
+     */
+    status = mprRunCmdPool(tc->pool, "exit", -1, &response, MPR_TEST_SLEEP);
+    tassert(status == MPR_ERR_CANT_COMPLETE);
+    for (i = 0; i < 100 && tc->pool->restarts == 0; i++) {
+        mprWaitForEvent(gp->dispatcher, 50);
+    }
+    tassert(tc->pool->restarts == 1);
+    for (i = 0; i < 4; i++) {
+        status = mprRunCmdPool(tc->pool, "after restart", -1, &response, MPR_TEST_SLEEP);
+        tassert(status == 0);
+        tassert(smatch(response, "after restart"));
+    }
+    mprDestroyCmdPool(tc->pool);
+    tassert(mprSubmitCmdPool(tc->pool, "data", -1, NULL, NULL) == MPR_ERR_BAD_STATE);
+    tc->pool = 0;
+}
+#endif
+
 
 MprTestDef testCmd = {
     "cmd", 0, initCmd, 0,
@@ -327,6 +403,9 @@ MprTestDef testCmd = {
         MPR_TEST(0, testWithData),
         MPR_TEST(0, testNoCapture),
         MPR_TEST(0, testMultiple),
+#if BIT_UNIX_LIKE
+        MPR_TEST(0, testCmdPool),
+#endif
         MPR_TEST(0, 0),
     },
 };
@@ -67,11 +67,47 @@ static void testCriticalSection(MprTestGroup *gp)
 }
 
 
+/*
+    Test timeouts, signalling before waiting and signalling after the wait has started
+ */
+static void testCondTimeout(MprTestGroup *gp)
+{
+    TestCond        *tc;
+    MprTicks        mark;
+
+    tc = gp->data;
+    tc->cond = mprCreateCond(gp);
+
+    mark = mprGetTicks();
+    tassert(mprWaitForCond(tc->cond, 0) == MPR_ERR_TIMEOUT);
+    tassert(mprWaitForCond(tc->cond, 20) == MPR_ERR_TIMEOUT);
+    tassert(mprGetElapsedTicks(mark) >= 19);
+
+    mprSignalCond(tc->cond);
+    mprSignalCond(tc->cond);
+    tassert(mprWaitForCond(tc->cond, 0) == 0);
+    tassert(mprWaitForCond(tc->cond, 0) == MPR_ERR_TIMEOUT);
+
+    mprSignalCond(tc->cond);
+    mprResetCond(tc->cond);
+    tassert(mprWaitForCond(tc->cond, 0) == MPR_ERR_TIMEOUT);
+
+    tc->event = mprCreateEvent(NULL, "testCondTimeout", 10, callback, tc->cond, MPR_EVENT_QUICK);
+    mprYield(MPR_YIELD_STICKY);
+    tassert(mprWaitForCond(tc->cond, MPR_TEST_TIMEOUT) == 0);
+    mprResetYield();
+
+    tc->cond = 0;
+    tc->event = 0;
+}
+
+
 MprTestDef testCond = {
     "cond", 0, initCond, 0,
     {
         MPR_TEST(0, testCriticalSection),
         MPR_TEST(0, testCriticalSection),
+        MPR_TEST(0, testCondTimeout),
         MPR_TEST(0, 0),
     },
 };
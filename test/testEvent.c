@@ -12,6 +12,14 @@
 
 typedef struct TestEvent {
     MprEvent    *event;
+    MprWorker   *worker;            /* Worker that ran the last sticky event */
+    int         count;              /* Count of sticky events run */
+    int         moved;              /* Count of sticky events that ran on a different worker */
+    int         fiberResult;        /* Value received by the fiber */
+    MprCond     *gate;              /* Holds the event service thread in gateCallback */
+    MprList     *dispatchers;       /* Dispatchers for the priority test */
+    int         order[32];          /* Priority classes in the order their dispatchers ran */
+    int         ran;                /* Count of entries in order */
 } TestEvent;
 
 static void manageTestEvent(TestEvent *te, int flags);
@@ -34,6 +42,9 @@ static void manageTestEvent(TestEvent *te, int flags)
 {
     if (flags & MPR_MANAGE_MARK) {
         mprMark(te->event);
+        mprMark(te->worker);
+        mprMark(te->gate);
+        mprMark(te->dispatchers);
     }
 }
 
@@ -98,12 +109,481 @@ static void testReschedEvent(MprTestGroup *gp)
 }
 
 
+#if MPR_WAIT_TIMER
+/*
+    The epoll notifier arms its timerfd for the next due event and the event fires when the timer expires
+ */
+static void testWaitTimer(MprTestGroup *gp)
+{
+    TestEvent           *te;
+    MprWaitService      *ws;
+    MprTicks            mark;
+    struct itimerspec   spec;
+
+    te = gp->data;
+    ws = MPR->waitService;
+    if (ws->timerFd < 0) {
+        /* Another notifier backend is in use */
+        return;
+    }
+    mark = mprGetTicks();
+    te->event = mprCreateEvent(NULL, "testWaitTimer", 50, eventCallback, (void*) gp, MPR_EVENT_QUICK);
+    tassert(te->event != 0);
+    mprNap(5);
+    tassert(timerfd_gettime(ws->timerFd, &spec) == 0);
+    tassert(spec.it_value.tv_sec == 0 && spec.it_value.tv_nsec > 0);
+    tassert(spec.it_value.tv_nsec <= 50 * 1000 * 1000);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    tassert(mprGetElapsedTicks(mark) >= 49);
+    te->event = 0;
+}
+#endif
+
+
+/*
+    Events must still be serviced promptly when the event loop busy-polls instead of blocking
+ */
+static void testSpinEvent(MprTestGroup *gp)
+{
+    TestEvent   *te;
+    int         i, old;
+
+    te = gp->data;
+    old = mprSetEventSpin(1000);
+
+    for (i = 0; i < 10; i++) {
+        te->event = mprCreateEvent(NULL, "testSpinEvent", 0, eventCallback, (void*) gp, 0);
+        tassert(te->event != 0);
+        tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    }
+    te->event = mprCreateEvent(NULL, "testSpinEvent", 10, eventCallback, (void*) gp, 0);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    te->event = 0;
+    mprSetEventSpin(old);
+}
+
+
+static void stickyCallback(MprTestGroup *gp, MprEvent *event)
+{
+    TestEvent   *te;
+    MprWorker   *worker;
+
+    te = gp->data;
+    worker = mprGetCurrentWorker();
+    if (te->worker && worker != te->worker) {
+        te->moved++;
+    }
+    te->worker = worker;
+    if (++te->count < 10) {
+        mprCreateEvent(event->dispatcher, "testStickyEvent", 1, stickyCallback, gp, 0);
+    } else {
+        mprSignalTestComplete(gp);
+    }
+}
+
+
+/*
+    Follow-up events on a sticky dispatcher run on the same worker within the batch budget
+ */
+static void testStickyEvent(MprTestGroup *gp)
+{
+    MprDispatcher   *dispatcher;
+    TestEvent       *te;
+
+    te = gp->data;
+    te->worker = 0;
+    te->count = te->moved = 0;
+    mprSetDispatcherBatch(MPR_DISPATCHER_BATCH, MPR_TEST_SLEEP);
+
+    dispatcher = mprCreateDispatcher("testStickyEvent", MPR_DISPATCHER_STICKY);
+    tassert(dispatcher != 0);
+    mprAddRoot(dispatcher);
+    te->event = mprCreateEvent(dispatcher, "testStickyEvent", 0, stickyCallback, gp, 0);
+    tassert(te->event != 0);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    tassert(te->count == 10);
+    tassert(te->worker != 0);
+    tassert(te->moved == 0);
+
+    mprSetDispatcherBatch(MPR_DISPATCHER_BATCH, 0);
+    mprRemoveRoot(dispatcher);
+    mprDestroyDispatcher(dispatcher);
+    te->event = 0;
+    te->worker = 0;
+}
+
+
+/*
+    Events run on dispatchers of all priority classes
+ */
+/*
+    Runs on the event service thread and holds it until the test has queued the priority dispatchers
+ */
+static void gateCallback(MprTestGroup *gp, MprEvent *event)
+{
+    TestEvent   *te;
+
+    te = gp->data;
+    mprSignalTestComplete(gp);
+    mprWaitForCond(te->gate, MPR_TEST_SLEEP);
+}
+
+
+static void priorityCallback(MprTestGroup *gp, MprEvent *event)
+{
+    TestEvent   *te;
+
+    te = gp->data;
+    if (te->ran < (int) (sizeof(te->order) / sizeof(int))) {
+        te->order[te->ran] = event->dispatcher->priority;
+    }
+    if (++te->ran == 20) {
+        mprSignalTestComplete(gp);
+    }
+}
+
+
+static void testPriorityEvent(MprTestGroup *gp)
+{
+    MprDispatcher   *high, *low, *gate, *dp;
+    TestEvent       *te;
+    int             i, lastHigh, firstLow, run, maxRun;
+
+    te = gp->data;
+    tassert(mprSetDispatcherClass(MPR_DISPATCHER_CLASSES, 1, 0) == MPR_ERR_BAD_ARGS);
+    tassert(mprSetDispatcherClass(MPR_DISPATCHER_CLASS_LOW, 0, 0) == MPR_ERR_BAD_ARGS);
+
+    high = mprCreateDispatcher("testPriorityHigh", MPR_DISPATCHER_HIGH);
+    low = mprCreateDispatcher("testPriorityLow", MPR_DISPATCHER_LOW);
+    tassert(high->priority == MPR_DISPATCHER_CLASS_HIGH);
+    tassert(low->priority == MPR_DISPATCHER_CLASS_LOW);
+    mprAddRoot(high);
+    mprAddRoot(low);
+
+    te->event = mprCreateEvent(low, "testPriorityEvent", 0, eventCallback, (void*) gp, 0);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    te->event = mprCreateEvent(high, "testPriorityEvent", 0, eventCallback, (void*) gp, 0);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+
+    /*
+        Weighted selection. Hold the event service thread while ten high and ten low dispatchers become ready. They 
+        are immediate dispatchers so they run on the service thread in the order they are selected.
+     */
+    tassert(mprSetDispatcherClass(MPR_DISPATCHER_CLASS_HIGH, 3, 0) == 0);
+    tassert(mprSetDispatcherClass(MPR_DISPATCHER_CLASS_LOW, 1, 0) == 0);
+    te->gate = mprCreateCond();
+    te->dispatchers = mprCreateList(0, 0);
+    te->ran = 0;
+    gate = mprCreateDispatcher("testPriorityGate", MPR_DISPATCHER_IMMEDIATE);
+    mprAddItem(te->dispatchers, gate);
+    mprCreateEvent(gate, "testPriorityGate", 0, gateCallback, (void*) gp, 0);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+
+    for (i = 0; i < 20; i++) {
+        dp = mprCreateDispatcher("testPriorityOrder", MPR_DISPATCHER_IMMEDIATE | 
+            ((i & 1) ? MPR_DISPATCHER_LOW : MPR_DISPATCHER_HIGH));
+        mprAddItem(te->dispatchers, dp);
+        mprCreateEvent(dp, "testPriorityOrder", 0, priorityCallback, (void*) gp, 0);
+    }
+    mprSignalCond(te->gate);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    tassert(te->ran == 20);
+
+    /*
+        With weights of 3:1, high dispatchers run at most three in a row once a round has started and all have run 
+        before the 14th selection. The first round may start with partial credit. Low dispatchers are not starved.
+     */
+    lastHigh = firstLow = -1;
+    for (i = run = maxRun = 0; i < te->ran; i++) {
+        if (te->order[i] == MPR_DISPATCHER_CLASS_HIGH) {
+            lastHigh = i;
+            if (++run > maxRun && firstLow >= 0) {
+                maxRun = run;
+            }
+        } else {
+            if (firstLow < 0) {
+                firstLow = i;
+            }
+            run = 0;
+        }
+    }
+    tassert(maxRun <= 3);
+    tassert(firstLow >= 0 && firstLow <= 6);
+    tassert(lastHigh >= 0 && lastHigh <= 13);
+
+    /*
+        Worker reserve. A low priority dispatcher may not start a worker that is reserved for the high class.
+     */
+    tassert(mprSetDispatcherClass(MPR_DISPATCHER_CLASS_HIGH, 8, 1000) == 0);
+    te->ran = 0;
+    te->event = mprCreateEvent(low, "testPriorityReserve", 0, eventCallback, (void*) gp, 0);
+    tassert(!mprWaitForTestToComplete(gp, 100));
+    te->event = mprCreateEvent(high, "testPriorityReserve", 0, eventCallback, (void*) gp, 0);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+
+    /* Releasing the reserve lets the pending low priority dispatcher run */
+    tassert(mprSetDispatcherClass(MPR_DISPATCHER_CLASS_HIGH, 8, 0) == 0);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    tassert(mprSetDispatcherClass(MPR_DISPATCHER_CLASS_LOW, 1, 0) == 0);
+
+    tassert(mprSetDispatcherPriority(low, MPR_DISPATCHER_CLASS_NORMAL) == 0);
+    tassert(low->priority == MPR_DISPATCHER_CLASS_NORMAL);
+    te->event = mprCreateEvent(low, "testPriorityEvent", 0, eventCallback, (void*) gp, 0);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    te->event = 0;
+
+    for (i = 0; (dp = mprGetItem(te->dispatchers, i)) != 0; i++) {
+        mprDestroyDispatcher(dp);
+    }
+    te->dispatchers = 0;
+    te->gate = 0;
+    mprRemoveRoot(high);
+    mprRemoveRoot(low);
+    mprDestroyDispatcher(high);
+    mprDestroyDispatcher(low);
+}
+
+
+static void slowCallback(void *data, MprEvent *event)
+{
+    mprNap(2);
+    mprSignalTestComplete((MprTestGroup*) data);
+}
+
+
+/*
+    Event statistics record scheduling delay and callback runtime per dispatcher
+ */
+static void testEventStats(MprTestGroup *gp)
+{
+    MprDispatcher   *dispatcher;
+    MprEventStats   *stats;
+    TestEvent       *te;
+    uint64          hist[MPR_EVENT_HIST];
+
+    memset(hist, 0, sizeof(hist));
+    tassert(mprGetEventStatsPercentile(hist, 50) == 0);
+    hist[1] = 90;
+    hist[4] = 10;
+    tassert(mprGetEventStatsPercentile(hist, 50) == 1);
+    tassert(mprGetEventStatsPercentile(hist, 99) == 15);
+
+    te = gp->data;
+    dispatcher = mprCreateDispatcher("testEventStats", 0);
+    mprAddRoot(dispatcher);
+    mprSetEventStats(1, 0);
+    tassert(mprGetDispatcherStats(dispatcher) == 0);
+
+    te->event = mprCreateEvent(dispatcher, "testEventStats", 0, slowCallback, (void*) gp, 0);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    /* The callback signals completion before it returns */
+    mprNap(10);
+    stats = mprGetDispatcherStats(dispatcher);
+    tassert(stats != 0);
+    if (stats) {
+        tassert(stats->count == 1);
+        tassert(stats->maxRuntime >= 1000);
+        tassert(mprGetEventStatsPercentile(stats->runtime, 100) >= 1000);
+    }
+    mprSetEventStats(0, 0);
+    te->event = 0;
+    mprRemoveRoot(dispatcher);
+    mprDestroyDispatcher(dispatcher);
+}
+
+
+/*
+    Continuous event that is still running when its dispatcher deadline expires
+ */
+static void runningCallback(MprTestGroup *gp, MprEvent *event)
+{
+    TestEvent   *te;
+
+    te = gp->data;
+    te->ran++;
+    mprNap(40);
+}
+
+
+static void testDeadline(MprTestGroup *gp)
+{
+    MprDispatcher   *dispatcher;
+    MprDeadline     *deadline;
+    MprEvent        *event, *kept;
+    TestEvent       *te;
+    MprTicks        mark;
+
+    te = gp->data;
+
+    dispatcher = mprCreateDispatcher("testDeadline", 0);
+    mprAddRoot(dispatcher);
+    event = mprCreateEvent(dispatcher, "testDeadline", 60 * 1000, eventCallback, (void*) gp, 0);
+    kept = mprCreateEvent(dispatcher, "testDeadlineKept", 60 * 1000, eventCallback, (void*) gp, MPR_EVENT_NO_CANCEL);
+    deadline = mprCreateDeadline(dispatcher, 20);
+    tassert(deadline != 0);
+    tassert(dispatcher->deadline == deadline);
+    tassert(!mprIsDeadlineExpired(deadline));
+    tassert(mprGetDeadlineRemaining(deadline) <= 20);
+
+    /* The wait is cut short by the deadline */
+    mark = mprGetTicks();
+    tassert(mprWaitForEvent(dispatcher, MPR_TEST_SLEEP) == MPR_ERR_TIMEOUT);
+    tassert(mprGetElapsedTicks(mark) < MPR_TEST_SLEEP);
+    tassert(mprIsDeadlineExpired(deadline));
+    tassert(mprGetDeadlineRemaining(deadline) == 0);
+
+    /* Pending events are cancelled unless created with MPR_EVENT_NO_CANCEL */
+    tassert(event->dispatcher == 0);
+    tassert(kept->dispatcher == dispatcher);
+    mprRemoveEvent(kept);
+
+    /* A removed deadline no longer governs the dispatcher */
+    deadline = mprCreateDeadline(dispatcher, 10);
+    mprRemoveDeadline(deadline);
+    tassert(dispatcher->deadline == 0);
+    mprNap(20);
+    tassert(!mprIsDeadlineExpired(deadline));
+
+    /* A continuous event running when the deadline expires is not rescheduled */
+    te->ran = 0;
+    deadline = mprCreateDeadline(dispatcher, 20);
+    event = mprCreateEvent(dispatcher, "testDeadlineRunning", 0, runningCallback, (void*) gp, MPR_EVENT_CONTINUOUS);
+    mprNap(200);
+    tassert(mprIsDeadlineExpired(deadline));
+    tassert(te->ran == 1);
+    tassert(!(event->flags & MPR_EVENT_CONTINUOUS));
+    mprRemoveEvent(event);
+
+    mprRemoveRoot(dispatcher);
+    mprDestroyDispatcher(dispatcher);
+}
+
+
+#if MPR_FIBER
+static void fiberProc(MprTestGroup *gp)
+{
+    TestEvent   *te;
+
+    te = gp->data;
+    tassert(mprGetCurrentFiber() != 0);
+    tassert(mprAwaitEvent(5) == MPR_ERR_TIMEOUT);
+    mprSignalTestComplete(gp);
+    te->fiberResult = mprAwaitEvent(MPR_TEST_SLEEP);
+    mprSignalTestComplete(gp);
+}
+
+
+/*
+    Fibers suspend in mprAwaitEvent until resumed or timed out
+ */
+static void testFiber(MprTestGroup *gp)
+{
+    MprFiber    *fiber;
+    TestEvent   *te;
+    MprTicks    mark;
+
+    te = gp->data;
+    te->fiberResult = 0;
+    tassert(mprGetCurrentFiber() == 0);
+    tassert(mprAwaitEvent(0) == MPR_ERR_BAD_STATE);
+
+    fiber = mprCreateFiber(NULL, (MprFiberProc) fiberProc, gp, 0);
+    tassert(fiber != 0);
+    mprAddRoot(fiber);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    mprResumeFiber(fiber, 42);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    tassert(te->fiberResult == 42);
+
+    /* The dispatcher created for the fiber is destroyed once the fiber completes */
+    mark = mprGetTicks();
+    while (!(fiber->dispatcher->flags & MPR_DISPATCHER_DESTROYED) && mprGetElapsedTicks(mark) < MPR_TEST_SLEEP) {
+        mprSleep(1);
+    }
+    tassert(fiber->state == MPR_FIBER_COMPLETE);
+    tassert((fiber->dispatcher->flags & MPR_DISPATCHER_DESTROYED) != 0);
+    mprRemoveRoot(fiber);
+}
+#endif
+
+
+#if BIT_UNIX_LIKE
+static void signalCallback(MprTestGroup *gp, MprSignal *sp)
+{
+    tassert(sp->signo == SIGUSR2);
+    mprSignalTestComplete(gp);
+}
+
+
+/*
+    Signal handlers run as events on a dispatcher
+ */
+static void testSignalEvent(MprTestGroup *gp)
+{
+    MprSignal   *sp;
+
+    sp = mprAddSignalHandler(SIGUSR2, signalCallback, gp, gp->dispatcher, MPR_SIGNAL_BEFORE);
+    tassert(sp != 0);
+    kill(getpid(), SIGUSR2);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    mprRemoveSignalHandler(sp);
+}
+#endif
+
+
+#if MPR_SIGNALFD
+/*
+    Asynchronous signals are blocked in all threads and are read from the signalfd by its wait handler
+ */
+static void testSignalfd(MprTestGroup *gp)
+{
+    MprSignalService    *ssp;
+    MprSignal           *sp;
+    sigset_t            mask;
+
+    ssp = MPR->signalService;
+    if (ssp->fd < 0) {
+        /* The signalfd could not be created. Signals use the signal handler. */
+        return;
+    }
+    tassert(ssp->handler != 0);
+    tassert(pthread_sigmask(SIG_SETMASK, 0, &mask) == 0);
+    tassert(sigismember(&mask, SIGUSR2) == 1);
+
+    sp = mprAddSignalHandler(SIGUSR2, signalCallback, gp, gp->dispatcher, MPR_SIGNAL_BEFORE);
+    tassert(sp != 0);
+    kill(getpid(), SIGUSR2);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    tassert(ssp->hasSignals == 0);
+    tassert(ssp->info[SIGUSR2].triggered == 0);
+    mprRemoveSignalHandler(sp);
+}
+#endif
+
+
 MprTestDef testEvent = {
     "event", 0, initEvent, 0,
     {
         MPR_TEST(0, testCreateEvent),
         MPR_TEST(0, testCancelEvent),
         MPR_TEST(0, testReschedEvent),
+#if MPR_WAIT_TIMER
+        MPR_TEST(0, testWaitTimer),
+#endif
+        MPR_TEST(0, testSpinEvent),
+        MPR_TEST(0, testStickyEvent),
+        MPR_TEST(0, testPriorityEvent),
+        MPR_TEST(0, testEventStats),
+        MPR_TEST(0, testDeadline),
+#if MPR_FIBER
+        MPR_TEST(0, testFiber),
+#endif
+#if BIT_UNIX_LIKE
+        MPR_TEST(0, testSignalEvent),
+#endif
+#if MPR_SIGNALFD
+        MPR_TEST(0, testSignalfd),
+#endif
         MPR_TEST(0, 0),
     },
 };
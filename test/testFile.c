@@ -15,6 +15,8 @@
 
 typedef struct TestFile {
     char        *name;
+    char        *buf;                   /* Buffer for async I/O */
+    ssize       result;                 /* Async I/O result */
 } TestFile;
 
 static char *makePath(cchar *name);
@@ -52,6 +54,7 @@ static void manageTestFile(TestFile *tf, int flags)
 {
     if (flags & MPR_MANAGE_MARK) {
         mprMark(tf->name);
+        mprMark(tf->buf);
     }
 }
 
@@ -205,6 +208,50 @@ static void testBufferedIO(MprTestGroup *gp)
     mprDeletePath(ts->name);
     tassert(!mprPathExists(ts->name, R_OK));
 }
+
+
+static void asyncReadComplete(void *data, MprIORequest *req)
+{
+    MprTestGroup    *gp;
+    TestFile        *ts;
+
+    gp = data;
+    ts = gp->data;
+    ts->result = req->result;
+    mprSignalTestComplete(gp);
+}
+
+
+static void testAsyncIO(MprTestGroup *gp)
+{
+    MprFile         *file;
+    MprIORequest    *req;
+    TestFile        *ts;
+    ssize           len;
+
+    ts = (TestFile*) gp->data;
+    mprDeletePath(ts->name);
+
+    file = mprOpenFile(ts->name, O_CREAT | O_TRUNC | O_RDWR | O_BINARY, FILEMODE);
+    tassert(file != 0);
+    len = mprWriteFile(file, "abcdef", 6);
+    tassert(len == 6);
+
+    /*
+        Read from offset 1 without moving the file position. Completes via the group dispatcher.
+     */
+    ts->buf = mprAlloc(64);
+    ts->result = -1;
+    req = mprSubmitIO(MPR_IO_READ, file->fd, ts->buf, 64, 1, gp->dispatcher, asyncReadComplete, gp);
+    tassert(req != 0);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    tassert(ts->result == 5);
+    tassert(memcmp(ts->buf, "bcdef", 5) == 0);
+    mprCloseFile(file);
+
+    mprDeletePath(ts->name);
+    ts->buf = 0;
+}
     
 
 /*
@@ -226,6 +273,7 @@ MprTestDef testFile = {
     {
         MPR_TEST(0, testBasicIO),
         MPR_TEST(0, testBufferedIO),
+        MPR_TEST(0, testAsyncIO),
         MPR_TEST(0, 0),
     },
 };
@@ -18,6 +18,19 @@ static MprOsThread      critical[2048];
 static MprMutex     *mutex;
 static int          threadCount;    
 
+#define RW_THREADS      4
+#define RW_ITERATIONS   2000
+
+typedef struct TestRW {
+    MprRWLock       *lock;
+    MprCond         *done;
+    int             a, b;
+    int             errors;
+    volatile int    finished;
+} TestRW;
+
+static void manageTestRW(TestRW *tr, int flags);
+
 /************************************ Code ************************************/
 
 static int initLock(MprTestGroup *gp)
@@ -66,10 +79,150 @@ static void testCriticalSection(MprTestGroup *gp)
 }
 
 
+static void testRecursiveLock(MprTestGroup *gp)
+{
+    MprMutex    *lock;
+
+    lock = mprCreateLock();
+    tassert(lock != 0);
+
+    mprLock(lock);
+    mprLock(lock);
+    tassert(mprTryLock(lock));
+    mprUnlock(lock);
+    mprUnlock(lock);
+    mprUnlock(lock);
+
+    tassert(mprTryLock(lock));
+    mprUnlock(lock);
+}
+
+
+static void testLockProfile(MprTestGroup *gp)
+{
+    MprMutex    *lock;
+    bool        prior;
+    int         i;
+
+    prior = mprSetLockProfile(1);
+    lock = mprCreateLock();
+    tassert(lock != 0);
+    for (i = 0; i < 10; i++) {
+        mprLock(lock);
+        mprUnlock(lock);
+    }
+#if MPR_FUTEX
+    tassert(lock->site != 0);
+    if (lock->site) {
+        tassert(lock->site->count >= 1);
+        tassert(lock->site->locks >= 10);
+        tassert(lock->site->waitTime >= lock->site->maxWait);
+    }
+#endif
+    mprSetLockProfile(prior);
+}
+
+
+static void testReaderWriterLock(MprTestGroup *gp)
+{
+    MprRWLock   *lock;
+    int         flags;
+
+    for (flags = 0; flags <= MPR_RWLOCK_PERCPU; flags += MPR_RWLOCK_PERCPU) {
+        lock = mprCreateRWLock(flags);
+        tassert(lock != 0);
+
+        mprReadLock(lock);
+        mprReadUnlock(lock);
+
+        /* Writers may recurse and may read while holding the write lock */
+        mprWriteLock(lock);
+        mprWriteLock(lock);
+        mprReadLock(lock);
+        mprReadUnlock(lock);
+        mprWriteUnlock(lock);
+        mprWriteUnlock(lock);
+
+        mprReadLock(lock);
+        mprReadUnlock(lock);
+    }
+}
+
+
+static void manageTestRW(TestRW *tr, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(tr->lock);
+        mprMark(tr->done);
+    }
+}
+
+
+static void rwProc(TestRW *tr, MprThread *tp)
+{
+    int     i;
+
+    for (i = 0; i < RW_ITERATIONS; i++) {
+        if ((i % 10) == 0) {
+            mprWriteLock(tr->lock);
+            tr->a++;
+            tr->b++;
+            mprWriteUnlock(tr->lock);
+        } else {
+            mprReadLock(tr->lock);
+            if (tr->a != tr->b) {
+                tr->errors++;
+            }
+            mprReadUnlock(tr->lock);
+        }
+    }
+    mprAtomicAdd(&tr->finished, 1);
+    if (tr->finished == RW_THREADS) {
+        mprSignalCond(tr->done);
+    }
+}
+
+
+/*
+    Readers must never observe a partial update by a writer
+ */
+static void testReaderWriterThreads(MprTestGroup *gp)
+{
+    TestRW      *tr;
+    MprThread   *tp;
+    int         flags, i;
+
+    for (flags = 0; flags <= MPR_RWLOCK_PERCPU; flags += MPR_RWLOCK_PERCPU) {
+        tr = mprAllocObj(TestRW, manageTestRW);
+        tr->lock = mprCreateRWLock(flags);
+        tr->done = mprCreateCond();
+        mprAddRoot(tr);
+
+        for (i = 0; i < RW_THREADS; i++) {
+            tp = mprCreateThread("testRW", (MprThreadProc) rwProc, tr, 0);
+            tassert(tp != 0);
+            mprStartThread(tp);
+        }
+        mprYield(MPR_YIELD_STICKY);
+        tassert(mprWaitForCond(tr->done, MPR_TEST_TIMEOUT) == 0);
+        mprResetYield();
+
+        tassert(tr->errors == 0);
+        tassert(tr->a == RW_THREADS * RW_ITERATIONS / 10);
+        tassert(tr->a == tr->b);
+        mprRemoveRoot(tr);
+    }
+}
+
+
 MprTestDef testLock = {
     "lock", 0, initLock, termLock,
     {
         MPR_TEST(0, testCriticalSection),
+        MPR_TEST(0, testRecursiveLock),
+        MPR_TEST(0, testLockProfile),
+        MPR_TEST(0, testReaderWriterLock),
+        MPR_TEST(0, testReaderWriterThreads),
         MPR_TEST(0, 0),
     },
 };
@@ -16,18 +16,49 @@ typedef struct TestSocket {
     MprSocket       *accepted;                  /* Server-side accepted client socket */
     MprSocket       *client;                    /* Client socket */
     MprBuf          *inBuf;                     /* Input buffer */
+    MprWaitHandler  *handler;                   /* Wait handler for recall tests */
+    MprList         *sockets;                   /* Sockets for batch accept tests */
     int             port;                       /* Server port */
+    int             fiberMask;                  /* I/O mask received by the fiber */
 } TestSocket;
 
+#if LINUX
+/*
+    The glibc tcp_info stops short of the segment counters. These follow it in the kernel structure.
+ */
+typedef struct TcpInfo {
+    struct tcp_info info;
+    uint64          pacingRate;
+    uint64          maxPacingRate;
+    uint64          bytesAcked;
+    uint64          bytesReceived;
+    uint            segsOut;
+    uint            segsIn;
+} TcpInfo;
+#endif
+
 static int warnNoInternet = 0;
 static int bufsize = 16 * 1024;
+static volatile int resolverCalls = 0;
+static volatile int resolverDown = 0;
+static volatile int zeroCopyDone = 0;
+static char zeroCopyBuf[64 * 1024];
+static char receiveBuf[64 * 1024];
 
 /***************************** Forward Declarations ***************************/
 
 static int acceptFn(MprTestGroup *gp, MprEvent *event);
+static MprSocket *connectPair(MprTestGroup *gp, MprSocket **accepted);
+static int fakeResolver(cchar *ip, int port, int *family, int *protocol, struct sockaddr_storage *addr, Socklen *addrlen);
 static void manageTestSocket(TestSocket *ts, int flags);
 static MprSocket *openServer(MprTestGroup *gp, cchar *host);
 static int readEvent(MprTestGroup *gp, MprEvent *event);
+static ssize readAll(MprSocket *sp, char *buf, ssize len);
+static void resolvedEvent(MprTestGroup *gp, MprEvent *event);
+static void zeroCopyEvent(MprTestGroup *gp, MprEvent *event);
+#if LINUX
+static int64 getSegmentsOut(MprSocket *sp);
+#endif
 
 /************************************ Code ************************************/
 /*
@@ -108,6 +139,8 @@ static void manageTestSocket(TestSocket *ts, int flags)
         mprMark(ts->accepted);
         mprMark(ts->client);
         mprMark(ts->inBuf);
+        mprMark(ts->handler);
+        mprMark(ts->sockets);
 
     } else if (flags & MPR_MANAGE_FREE) {
         mprCloseSocket(ts->accepted, 0);
@@ -318,6 +351,681 @@ static void testClientSslv4(MprTestGroup *gp)
 }
 
 
+#if BIT_UNIX_LIKE
+static void recallEvent(MprTestGroup *gp, MprEvent *event)
+{
+    tassert(event->mask & MPR_READABLE);
+    mprSignalTestComplete(gp);
+}
+
+
+/*
+    Recall handlers without any I/O on the descriptor, as is done for sockets with buffered data
+ */
+static void testRecallHandler(MprTestGroup *gp)
+{
+    TestSocket      *ts;
+    int             fds[2];
+
+    ts = gp->data;
+    tassert(socketpair(AF_UNIX, SOCK_STREAM, 0, fds) == 0);
+
+    ts->handler = mprCreateWaitHandler(fds[0], MPR_READABLE, gp->dispatcher, recallEvent, gp, 0);
+    tassert(ts->handler != 0);
+    mprRecallWaitHandlerByFd(fds[0]);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+
+    mprWaitOn(ts->handler, MPR_READABLE);
+    mprRecallWaitHandler(ts->handler);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+
+    mprRemoveWaitHandler(ts->handler);
+    ts->handler = 0;
+    close(fds[0]);
+    close(fds[1]);
+}
+#endif
+
+
+/*
+    Accept several pending connections in one call. Remote addresses are formatted on demand.
+    A single accept formats them immediately.
+ */
+static void testAcceptSockets(MprTestGroup *gp)
+{
+    TestSocket      *ts;
+    MprSocket       *sp, *accepted[8];
+    MprTicks        mark;
+    int             count, i, port;
+
+    ts = gp->data;
+    ts->sockets = mprCreateList(0, 0);
+    ts->server = mprCreateSocket(NULL);
+    for (port = 9350; port < 9450; port++) {
+        if (mprListenOnSocket(ts->server, "127.0.0.1", port, 0) != SOCKET_ERROR) {
+            break;
+        }
+    }
+    tassert(port < 9450);
+    tassert(mprAcceptSockets(ts->server, accepted, 8) == 0);
+
+    for (i = 0; i < 3; i++) {
+        sp = mprCreateSocket(NULL);
+        mprAddItem(ts->sockets, sp);
+        tassert(mprConnectSocket(sp, "127.0.0.1", port, MPR_SOCKET_BLOCK) >= 0);
+    }
+    count = mprAcceptSockets(ts->server, accepted, 8);
+    tassert(count == 3);
+    for (i = 0; i < count; i++) {
+        sp = accepted[i];
+        mprAddItem(ts->sockets, sp);
+        tassert(sp->fd >= 0);
+        tassert((sp->flags & MPR_SOCKET_SERVER) != 0);
+        tassert(sp->port > 0);
+        tassert(smatch(mprGetSocketIp(sp), "127.0.0.1"));
+        tassert(smatch(mprGetSocketAcceptIp(sp), "127.0.0.1"));
+        tassert(sp->acceptPort == port);
+#if BIT_UNIX_LIKE
+        tassert((fcntl(sp->fd, F_GETFD) & FD_CLOEXEC) != 0);
+        tassert((fcntl(sp->fd, F_GETFL) & O_NONBLOCK) != 0);
+#endif
+    }
+    tassert(mprAcceptSockets(ts->server, accepted, 8) == 0);
+
+    /* A single accept sets the addresses directly */
+    sp = mprCreateSocket(NULL);
+    mprAddItem(ts->sockets, sp);
+    tassert(mprConnectSocket(sp, "127.0.0.1", port, MPR_SOCKET_BLOCK) >= 0);
+    mark = mprGetTicks();
+    while ((sp = mprAcceptSocket(ts->server)) == 0 && mprGetElapsedTicks(mark) < MPR_TEST_SLEEP) {
+        mprSleep(1);
+    }
+    tassert(sp != 0);
+    if (sp) {
+        mprAddItem(ts->sockets, sp);
+        tassert(smatch(sp->ip, "127.0.0.1"));
+        tassert(smatch(sp->acceptIp, "127.0.0.1"));
+        tassert(sp->acceptPort == port);
+    }
+
+    for (i = 0; (sp = mprGetItem(ts->sockets, i)) != 0; i++) {
+        mprCloseSocket(sp, 0);
+    }
+    mprCloseSocket(ts->server, 0);
+    ts->server = 0;
+    ts->sockets = 0;
+}
+
+
+/*
+    Sharded listeners share one port and every connection is accepted by exactly one of them
+ */
+static void testListenShards(MprTestGroup *gp)
+{
+    TestSocket      *ts;
+    MprSocket       *sp, *accepted[8];
+    MprList         *listeners;
+    MprTicks        mark;
+    int             count, i, next, port;
+
+    ts = gp->data;
+    ts->sockets = mprCreateList(0, 0);
+    listeners = 0;
+    for (port = 9550; port < 9650; port++) {
+        if ((listeners = mprListenOnSockets("127.0.0.1", port, MPR_SOCKET_REUSEPORT_CPU, 2)) != 0) {
+            break;
+        }
+    }
+    tassert(listeners != 0);
+    if (listeners == 0) {
+        return;
+    }
+#if defined(SO_REUSEPORT)
+    tassert(mprGetListLength(listeners) == 2);
+#endif
+    for (next = 0; (sp = mprGetItem(listeners, next)) != 0; next++) {
+        mprAddItem(ts->sockets, sp);
+        tassert((sp->flags & MPR_SOCKET_LISTENER) != 0);
+    }
+    for (i = 0; i < 6; i++) {
+        sp = mprCreateSocket(NULL);
+        mprAddItem(ts->sockets, sp);
+        tassert(mprConnectSocket(sp, "127.0.0.1", port, MPR_SOCKET_BLOCK) >= 0);
+    }
+    count = 0;
+    mark = mprGetTicks();
+    while (count < 6 && mprGetElapsedTicks(mark) < MPR_TEST_SLEEP) {
+        for (next = 0; (sp = mprGetItem(listeners, next)) != 0; next++) {
+            for (i = mprAcceptSockets(sp, accepted, 8); i > 0; i--) {
+                tassert(accepted[i - 1]->acceptPort == port);
+                mprAddItem(ts->sockets, accepted[i - 1]);
+                count++;
+            }
+        }
+        if (count < 6) {
+            mprSleep(1);
+        }
+    }
+    tassert(count == 6);
+
+    for (i = 0; (sp = mprGetItem(ts->sockets, i)) != 0; i++) {
+        mprCloseSocket(sp, 0);
+    }
+    ts->sockets = 0;
+}
+
+
+/*
+    Datagram destinations are resolved once at connect time and batches are sent and received per system call
+ */
+static void testDatagramBatch(MprTestGroup *gp)
+{
+    TestSocket      *ts;
+    MprSocket       *server, *client;
+    MprIOVec        out[3], in[4];
+    MprTicks        mark;
+    char            bufs[4][64], buf[64];
+    int             count, i, port, rc;
+
+    ts = gp->data;
+    ts->sockets = mprCreateList(0, 0);
+    server = mprCreateSocket(NULL);
+    mprAddItem(ts->sockets, server);
+    for (port = 9650; port < 9750; port++) {
+        if (mprListenOnSocket(server, "127.0.0.1", port, MPR_SOCKET_DATAGRAM) != SOCKET_ERROR) {
+            break;
+        }
+    }
+    tassert(port < 9750);
+    client = mprCreateSocket(NULL);
+    mprAddItem(ts->sockets, client);
+    tassert(mprConnectSocket(client, "127.0.0.1", port, MPR_SOCKET_DATAGRAM) == 0);
+    tassert(client->addrlen > 0);
+    for (i = 0; i < 4; i++) {
+        in[i].start = bufs[i];
+        in[i].len = sizeof(bufs[i]);
+    }
+    tassert(mprReadSocketBatch(client, in, 4) == 0);
+
+    out[0].start = "one";
+    out[1].start = "two";
+    out[2].start = "three";
+    for (i = 0; i < 3; i++) {
+        out[i].len = slen(out[i].start);
+    }
+    tassert(mprWriteSocketBatch(client, out, 3) == 3);
+    tassert(mprWriteSocket(client, "four", 4) == 4);
+
+    count = 0;
+    mark = mprGetTicks();
+    while (count < 3 && mprGetElapsedTicks(mark) < MPR_TEST_SLEEP) {
+        for (i = 0; i < 4; i++) {
+            in[i].start = bufs[i];
+            in[i].len = sizeof(bufs[i]);
+        }
+        rc = mprReadSocketBatch(server, in, 3 - count);
+        tassert(rc >= 0);
+        for (i = 0; i < rc; i++, count++) {
+            tassert(in[i].len == out[count].len);
+            tassert(memcmp(in[i].start, out[count].start, in[i].len) == 0);
+        }
+        if (count < 3) {
+            mprSleep(1);
+        }
+    }
+    tassert(count == 3);
+
+    mark = mprGetTicks();
+    while ((rc = (int) mprReadSocket(server, buf, sizeof(buf))) == 0 && mprGetElapsedTicks(mark) < MPR_TEST_SLEEP) {
+        mprSleep(1);
+    }
+    tassert(rc == 4);
+    tassert(memcmp(buf, "four", 4) == 0);
+
+    tassert(mprWriteSocketBatch(server, out, 1) != MPR_ERR_BAD_STATE);
+    mprCloseSocket(client, 0);
+    tassert(mprWriteSocketBatch(client, out, 1) == MPR_ERR_BAD_STATE);
+    mprCloseSocket(server, 0);
+    ts->sockets = 0;
+}
+
+
+/*
+    Resolve hosts named "fake*" to the loopback address and fail all others. Fail all hosts while resolverDown is set.
+ */
+static int fakeResolver(cchar *ip, int port, int *family, int *protocol, struct sockaddr_storage *addr, Socklen *addrlen)
+{
+    struct sockaddr_in  *sa;
+
+    resolverCalls++;
+    if (resolverDown || !sstarts(ip, "fake")) {
+        return MPR_ERR_CANT_FIND;
+    }
+    sa = (struct sockaddr_in*) addr;
+    memset(sa, 0, sizeof(struct sockaddr_in));
+    sa->sin_family = AF_INET;
+    sa->sin_port = htons((ushort) port);
+    sa->sin_addr.s_addr = htonl(INADDR_LOOPBACK);
+    *addrlen = sizeof(struct sockaddr_in);
+    *family = AF_INET;
+    *protocol = 0;
+    return 0;
+}
+
+
+static void resolvedEvent(MprTestGroup *gp, MprEvent *event)
+{
+    mprSignalTestComplete(gp);
+}
+
+
+static void testResolverCache(MprTestGroup *gp)
+{
+    struct sockaddr     *addr;
+    Socklen             addrlen;
+    MprTicks            mark;
+    int                 calls, family, protocol;
+
+    resolverCalls = 0;
+    mprSetSocketResolver(fakeResolver);
+
+    /* Addresses are cached by host for all ports */
+    tassert(mprGetSocketInfo("fake.example.com", 80, &family, &protocol, &addr, &addrlen) == 0);
+    tassert(family == AF_INET);
+    tassert(ntohs(((struct sockaddr_in*) addr)->sin_port) == 80);
+    tassert(mprGetSocketInfo("fake.example.com", 81, &family, &protocol, &addr, &addrlen) == 0);
+    tassert(ntohs(((struct sockaddr_in*) addr)->sin_port) == 81);
+    tassert(resolverCalls == 1);
+
+    /* Failures are not cached by default */
+    tassert(mprGetSocketInfo("missing.example.com", 80, &family, &protocol, &addr, &addrlen) == MPR_ERR_CANT_FIND);
+    tassert(mprGetSocketInfo("missing.example.com", 80, &family, &protocol, &addr, &addrlen) == MPR_ERR_CANT_FIND);
+    tassert(resolverCalls == 3);
+
+    /* Failures are cached with a fail timeout */
+    mprSetSocketResolverCache(MPR_TIMEOUT_DNS, 5000);
+    tassert(mprGetSocketInfo("missing.example.com", 80, &family, &protocol, &addr, &addrlen) == MPR_ERR_CANT_FIND);
+    tassert(mprGetSocketInfo("missing.example.com", 80, &family, &protocol, &addr, &addrlen) == MPR_ERR_CANT_FIND);
+    tassert(resolverCalls == 4);
+
+    /* Expired addresses are used while a worker refreshes them */
+    mprSetSocketResolverCache(1, 0);
+    tassert(mprGetSocketInfo("fake.example.com", 80, &family, &protocol, &addr, &addrlen) == 0);
+    tassert(resolverCalls == 5);
+    mprSleep(5);
+    tassert(mprGetSocketInfo("fake.example.com", 80, &family, &protocol, &addr, &addrlen) == 0);
+    mark = mprGetTicks();
+    while (resolverCalls < 6 && mprGetElapsedTicks(mark) < MPR_TEST_SLEEP) {
+        mprSleep(1);
+    }
+    tassert(resolverCalls >= 6);
+
+    /* A failed refresh keeps the last good address for one more cache period */
+    mprSetSocketResolverCache(200, 0);
+    tassert(mprGetSocketInfo("fake.example.net", 80, &family, &protocol, &addr, &addrlen) == 0);
+    mprSleep(250);
+    resolverDown = 1;
+    tassert(mprResolveSocketInfo("fake.example.net", gp->dispatcher, resolvedEvent, gp) == 0);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    tassert(mprLookupKey(MPR->socketService->dnsCache, "fake.example.net") != 0);
+    tassert(mprGetSocketInfo("fake.example.net", 80, &family, &protocol, &addr, &addrlen) == 0);
+
+    /* Once that period has passed, a failed refresh discards it */
+    mprSleep(200);
+    tassert(mprResolveSocketInfo("fake.example.net", gp->dispatcher, resolvedEvent, gp) == 0);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    tassert(mprLookupKey(MPR->socketService->dnsCache, "fake.example.net") == 0);
+    resolverDown = 0;
+
+    /* Background resolution warms the cache */
+    mprSetSocketResolverCache(MPR_TIMEOUT_DNS, MPR_TIMEOUT_DNS_FAIL);
+    calls = resolverCalls;
+    tassert(mprResolveSocketInfo("fake.example.org", gp->dispatcher, resolvedEvent, gp) == 0);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    tassert(resolverCalls == calls + 1);
+    tassert(mprGetSocketInfo("fake.example.org", 80, &family, &protocol, &addr, &addrlen) == 0);
+    tassert(resolverCalls == calls + 1);
+
+    /* The default resolver uses the system hosts file */
+    mprSetSocketResolver(NULL);
+    tassert(mprGetSocketInfo("localhost", 80, &family, &protocol, &addr, &addrlen) == 0);
+    tassert(mprLookupKey(MPR->socketService->dnsCache, "localhost") != 0);
+}
+
+
+/*
+    Open a loopback connection. The sockets are retained in ts->sockets.
+ */
+static MprSocket *connectPair(MprTestGroup *gp, MprSocket **accepted)
+{
+    TestSocket      *ts;
+    MprSocket       *listen, *client;
+    MprTicks        mark;
+    int             port;
+
+    ts = gp->data;
+    ts->sockets = mprCreateList(0, 0);
+    listen = mprCreateSocket(NULL);
+    mprAddItem(ts->sockets, listen);
+    for (port = 9750; port < 9850; port++) {
+        if (mprListenOnSocket(listen, "127.0.0.1", port, 0) != SOCKET_ERROR) {
+            break;
+        }
+    }
+    if (port >= 9850) {
+        return 0;
+    }
+    client = mprCreateSocket(NULL);
+    mprAddItem(ts->sockets, client);
+    if (mprConnectSocket(client, "127.0.0.1", port, MPR_SOCKET_BLOCK) < 0) {
+        return 0;
+    }
+    mark = mprGetTicks();
+    while ((*accepted = mprAcceptSocket(listen)) == 0 && mprGetElapsedTicks(mark) < MPR_TEST_SLEEP) {
+        mprSleep(1);
+    }
+    mprAddItem(ts->sockets, *accepted);
+    mprCloseSocket(listen, 0);
+    mprSetSocketBlockingMode(client, 0);
+    return *accepted ? client : 0;
+}
+
+
+static ssize readAll(MprSocket *sp, char *buf, ssize len)
+{
+    MprTicks    mark;
+    ssize       nbytes, sofar;
+
+    mark = mprGetTicks();
+    for (sofar = 0; sofar < len && mprGetElapsedTicks(mark) < MPR_TEST_SLEEP; ) {
+        if ((nbytes = mprReadSocket(sp, &buf[sofar], len - sofar)) < 0) {
+            break;
+        } else if (nbytes == 0) {
+            mprSleep(1);
+        }
+        sofar += nbytes;
+    }
+    return sofar;
+}
+
+
+static void zeroCopyEvent(MprTestGroup *gp, MprEvent *event)
+{
+    zeroCopyDone++;
+}
+
+
+/*
+    The completion callback runs once the kernel has released the buffer
+ */
+static void testZeroCopy(MprTestGroup *gp)
+{
+    TestSocket      *ts;
+    MprSocket       *client, *accepted;
+    MprTicks        mark;
+    ssize           got, len, nbytes, sofar;
+    int             i;
+
+    ts = gp->data;
+    client = connectPair(gp, &accepted);
+    tassert(client != 0);
+    if (client == 0) {
+        return;
+    }
+    len = sizeof(zeroCopyBuf);
+    for (i = 0; i < len; i++) {
+        zeroCopyBuf[i] = 'a' + (i % 26);
+    }
+    memset(receiveBuf, 0, sizeof(receiveBuf));
+    zeroCopyDone = 0;
+
+    /* A non-blocking socket may accept less than the full buffer. Drain so the sender is not blocked. */
+    got = 0;
+    mark = mprGetTicks();
+    for (sofar = 0; sofar < len && mprGetElapsedTicks(mark) < MPR_TEST_SLEEP; ) {
+        nbytes = mprWriteSocketZeroCopy(client, &zeroCopyBuf[sofar], len - sofar, zeroCopyEvent, gp);
+        tassert(nbytes >= 0);
+        if (nbytes > 0) {
+            sofar += nbytes;
+        }
+        if ((nbytes = mprReadSocket(accepted, &receiveBuf[got], len - got)) > 0) {
+            got += nbytes;
+        }
+    }
+    tassert(sofar == len);
+    got += readAll(accepted, &receiveBuf[got], len - got);
+    tassert(got == len);
+    tassert(memcmp(receiveBuf, zeroCopyBuf, len) == 0);
+
+    /* Completions are collected without further I/O on the socket */
+    mark = mprGetTicks();
+    while (zeroCopyDone == 0 && mprGetElapsedTicks(mark) < MPR_TEST_SLEEP) {
+        mprSleep(1);
+    }
+    tassert(zeroCopyDone > 0);
+
+    /* Closing the socket completes outstanding sends */
+    zeroCopyDone = 0;
+    tassert(mprWriteSocketZeroCopy(client, zeroCopyBuf, 32 * 1024, zeroCopyEvent, gp) > 0);
+    mprCloseSocket(client, 0);
+    mark = mprGetTicks();
+    while (zeroCopyDone == 0 && mprGetElapsedTicks(mark) < MPR_TEST_SLEEP) {
+        mprSleep(1);
+    }
+    tassert(zeroCopyDone == 1);
+
+    for (i = 0; (accepted = mprGetItem(ts->sockets, i)) != 0; i++) {
+        mprCloseSocket(accepted, 0);
+    }
+    ts->sockets = 0;
+}
+
+
+#if BIT_UNIX_LIKE
+/*
+    Forward pipe data to a socket with splice and tee
+ */
+static void testSpliceToSocket(MprTestGroup *gp)
+{
+    TestSocket      *ts;
+    MprSocket       *client, *accepted;
+    MprTicks        mark;
+    char            buf[64], data[16 * 1024];
+    ssize           len, rc, sofar;
+    int             fds[2], i;
+
+    ts = gp->data;
+    client = connectPair(gp, &accepted);
+    tassert(client != 0);
+    if (client == 0) {
+        return;
+    }
+    tassert(pipe(fds) == 0);
+    fcntl(fds[0], F_SETFL, fcntl(fds[0], F_GETFL) | O_NONBLOCK);
+    len = sizeof(data);
+    for (i = 0; i < len; i++) {
+        data[i] = 'a' + (i % 26);
+    }
+    tassert(write(fds[1], data, len) == len);
+
+    mark = mprGetTicks();
+    for (sofar = 0; sofar < len && mprGetElapsedTicks(mark) < MPR_TEST_SLEEP; sofar += rc) {
+        rc = mprSpliceToSocket(client, fds[0], len - sofar, 0);
+        tassert(rc >= 0);
+        if (rc < 0) {
+            break;
+        }
+    }
+    tassert(sofar == len);
+    tassert(readAll(accepted, receiveBuf, len) == len);
+    tassert(memcmp(receiveBuf, data, len) == 0);
+
+    /* Tee leaves the data in the pipe for its reader */
+    tassert(write(fds[1], "hello", 5) == 5);
+    rc = mprSpliceToSocket(client, fds[0], sizeof(buf), MPR_SPLICE_TEE);
+#if LINUX
+    tassert(rc == 5);
+    memset(buf, 0, sizeof(buf));
+    tassert(read(fds[0], buf, sizeof(buf)) == 5);
+    tassert(smatch(buf, "hello"));
+    memset(buf, 0, sizeof(buf));
+    tassert(readAll(accepted, buf, 5) == 5);
+    tassert(smatch(buf, "hello"));
+#else
+    tassert(rc == MPR_ERR_BAD_STATE);
+    tassert(read(fds[0], buf, sizeof(buf)) == 5);
+#endif
+    /* Empty pipe, then end of file */
+    tassert(mprSpliceToSocket(client, fds[0], len, 0) == 0);
+    close(fds[1]);
+    tassert(mprSpliceToSocket(client, fds[0], len, 0) == -1);
+    close(fds[0]);
+
+    for (i = 0; (accepted = mprGetItem(ts->sockets, i)) != 0; i++) {
+        mprCloseSocket(accepted, 0);
+    }
+    ts->sockets = 0;
+}
+#endif
+
+
+#if LINUX
+/*
+    Return the count of TCP segments sent on the socket or -1 if the kernel does not report it
+ */
+static int64 getSegmentsOut(MprSocket *sp)
+{
+    TcpInfo     ti;
+    socklen_t   len;
+
+    memset(&ti, 0, sizeof(ti));
+    len = sizeof(ti);
+    if (getsockopt(sp->fd, IPPROTO_TCP, TCP_INFO, &ti, &len) < 0 || len < sizeof(ti)) {
+        return -1;
+    }
+    return ti.segsOut;
+}
+#endif
+
+
+#if !BIT_ROM
+/*
+    Send a small file that is combined with its headers and trailers in one write, then a larger one sent via sendfile
+ */
+static void testSendFileToSocket(MprTestGroup *gp)
+{
+    TestSocket      *ts;
+    MprSocket       *client, *accepted;
+    MprFile         *file;
+    MprIOVec        before[2], after[1];
+    MprOff          total;
+    ssize           len;
+    int             i, round;
+#if LINUX
+    int64           segs;
+#endif
+
+    ts = gp->data;
+    client = connectPair(gp, &accepted);
+    tassert(client != 0);
+    if (client == 0) {
+        return;
+    }
+    if ((file = mprOpenFile(mprGetTempPath(NULL), O_CREAT | O_TRUNC | O_RDWR | O_BINARY, 0644)) == 0) {
+        tassert(file != 0);
+        return;
+    }
+    mprAddRoot(file);
+    for (i = 0; i < (int) sizeof(zeroCopyBuf); i++) {
+        zeroCopyBuf[i] = 'a' + (i % 26);
+    }
+    tassert(mprWriteFile(file, zeroCopyBuf, sizeof(zeroCopyBuf)) == sizeof(zeroCopyBuf));
+
+    before[0].start = "HTTP/1.1 200 OK\r\n";
+    before[0].len = 17;
+    before[1].start = "Content-Type: text/plain\r\n\r\n";
+    before[1].len = 28;
+    after[0].start = "\r\n0\r\n\r\n";
+    after[0].len = 7;
+
+    for (round = 0; round < 2; round++) {
+        len = round == 0 ? 1000 : 12000;
+        total = before[0].len + before[1].len + len + after[0].len;
+#if LINUX
+        segs = getSegmentsOut(client);
+#endif
+        tassert(mprSendFileToSocket(client, file, 100, total, before, 2, after, 1) == total);
+#if LINUX
+        if (round == 0 && segs >= 0) {
+            /* The small response leaves in one segment */
+            tassert(getSegmentsOut(client) == segs + 1);
+        }
+#endif
+        tassert(readAll(accepted, receiveBuf, 45) == 45);
+        tassert(strncmp(receiveBuf, "HTTP/1.1 200 OK\r\nContent-Type: text/plain\r\n\r\n", 45) == 0);
+        tassert(readAll(accepted, receiveBuf, len) == len);
+        tassert(memcmp(receiveBuf, &zeroCopyBuf[100], len) == 0);
+        tassert(readAll(accepted, receiveBuf, 7) == 7);
+        tassert(strncmp(receiveBuf, "\r\n0\r\n\r\n", 7) == 0);
+    }
+    mprDeletePath(file->path);
+    mprCloseFile(file);
+    mprRemoveRoot(file);
+
+    for (i = 0; (accepted = mprGetItem(ts->sockets, i)) != 0; i++) {
+        mprCloseSocket(accepted, 0);
+    }
+    ts->sockets = 0;
+}
+#endif
+
+
+#if MPR_FIBER
+static void fiberAccept(MprTestGroup *gp)
+{
+    TestSocket      *ts;
+
+    ts = gp->data;
+    tassert(mprAwaitIO(ts->server, MPR_READABLE, 5) == 0);
+    ts->fiberMask = mprAwaitIO(ts->server, MPR_READABLE, MPR_TEST_SLEEP);
+    mprSignalTestComplete(gp);
+}
+
+
+/*
+    A fiber suspends in mprAwaitIO until the listening socket has a connection to accept
+ */
+static void testFiberIO(MprTestGroup *gp)
+{
+    TestSocket      *ts;
+    MprFiber        *fiber;
+    int             port;
+
+    ts = gp->data;
+    ts->fiberMask = 0;
+    ts->server = mprCreateSocket(NULL);
+    for (port = 9250; port < 9350; port++) {
+        if (mprListenOnSocket(ts->server, "127.0.0.1", port, 0) != SOCKET_ERROR) {
+            break;
+        }
+    }
+    tassert(port < 9350);
+    fiber = mprCreateFiber(NULL, (MprFiberProc) fiberAccept, gp, 0);
+    tassert(fiber != 0);
+    mprNap(20);
+
+    ts->client = mprCreateSocket(NULL);
+    tassert(mprConnectSocket(ts->client, "127.0.0.1", port, 0) >= 0);
+    tassert(mprWaitForTestToComplete(gp, MPR_TEST_SLEEP));
+    tassert(ts->fiberMask & MPR_READABLE);
+
+    mprCloseSocket(ts->client, 0);
+    mprCloseSocket(ts->server, 0);
+    ts->client = ts->server = 0;
+}
+#endif
+
+
 MprTestDef testSocket = {
     "socket", 0, initSocket, termSocket,
     {
@@ -328,6 +1036,23 @@ MprTestDef testSocket = {
         MPR_TEST(0, testClientServerIPv6),
 #endif
         MPR_TEST(0, testClientSslv4),
+#if BIT_UNIX_LIKE
+        MPR_TEST(0, testRecallHandler),
+#endif
+        MPR_TEST(0, testAcceptSockets),
+        MPR_TEST(0, testListenShards),
+        MPR_TEST(0, testDatagramBatch),
+        MPR_TEST(0, testResolverCache),
+        MPR_TEST(0, testZeroCopy),
+#if BIT_UNIX_LIKE
+        MPR_TEST(0, testSpliceToSocket),
+#endif
+#if !BIT_ROM
+        MPR_TEST(0, testSendFileToSocket),
+#endif
+#if MPR_FIBER
+        MPR_TEST(0, testFiberIO),
+#endif
         MPR_TEST(0, 0),
     },
 };
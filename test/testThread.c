@@ -30,10 +30,186 @@ static void testStartWorker(MprTestGroup *gp)
 }
 
 
+static void queuedProc(volatile int *count, MprWorker *worker)
+{
+    mprAtomicAdd(count, 1);
+}
+
+
+/*
+    Start more tasks than there are workers. Excess tasks are queued on busy workers and run or stolen later.
+ */
+static void testQueueWorkers(MprTestGroup *gp)
+{
+    volatile int    *count;
+    int             i, accepted;
+
+    gp->data = (void*) (count = mprAllocZeroed(sizeof(int)));
+    for (i = accepted = 0; i < 64; i++) {
+        if (mprStartWorker((MprWorkerProc) queuedProc, (void*) count) == 0) {
+            accepted++;
+        }
+    }
+    /* May race with other test threads and find all run queues full */
+    for (i = 0; i < 100 && *count < accepted; i++) {
+        mprNap(50);
+    }
+    tassert(*count == accepted);
+}
+
+
+typedef struct TestAdapt {
+    MprList         *dispatchers;
+    volatile int    spinning;
+    volatile int    ran;
+} TestAdapt;
+
+
+static void manageTestAdapt(TestAdapt *ta, int flags)
+{
+    if (flags & MPR_MANAGE_MARK) {
+        mprMark(ta->dispatchers);
+    }
+}
+
+
+static void spinCallback(TestAdapt *ta, MprEvent *event)
+{
+    MprTicks    mark;
+
+    mark = mprGetTicks();
+    mprAtomicAdd(&ta->spinning, 1);
+    while (!ta->ran && mprGetElapsedTicks(mark) < 2000) {
+        mprYield(0);
+    }
+    mprAtomicAdd(&ta->spinning, -1);
+}
+
+
+static void waitingCallback(TestAdapt *ta, MprEvent *event)
+{
+    ta->ran = ta->spinning ? 1 : -1;
+}
+
+
+/*
+    Keep all cores busy. With adaptive sizing, a dispatcher pending for a worker gets one after the latency target.
+ */
+static void testAdaptiveWorkers(MprTestGroup *gp)
+{
+    MprDispatcher   *dispatcher;
+    MprWorkerStats  stats;
+    TestAdapt       *ta;
+    int             i, cores, grown, next, others, spinners;
+
+    gp->data = ta = mprAllocObj(TestAdapt, manageTestAdapt);
+    ta->dispatchers = mprCreateList(0, 0);
+    ta->spinning = ta->ran = 0;
+
+    mprSetWorkerLatency(10);
+    mprGetWorkerStats(&stats);
+    cores = max(MPR->heap->stats.numCpu, 1);
+    tassert(stats.target >= cores);
+    grown = stats.grown;
+
+    for (i = 0; i < cores; i++) {
+        dispatcher = mprCreateDispatcher("testAdaptSpin", 0);
+        mprAddItem(ta->dispatchers, dispatcher);
+        mprCreateEvent(dispatcher, "spin", 0, spinCallback, ta, 0);
+    }
+    for (i = 0; i < 100 && ta->spinning < cores; i++) {
+        mprNap(10);
+    }
+    spinners = ta->spinning;
+    mprGetWorkerStats(&stats);
+    others = stats.idle + stats.busy - spinners;
+    dispatcher = mprCreateDispatcher("testAdaptWait", 0);
+    mprAddItem(ta->dispatchers, dispatcher);
+    mprCreateEvent(dispatcher, "waiting", 0, waitingCallback, ta, 0);
+    for (i = 0; i < 200 && !ta->ran; i++) {
+        mprNap(10);
+    }
+    /* May race with other test threads for workers */
+    if (gp->service->numThreads == 1 && mprGetMaxWorkers() > cores && spinners == cores) {
+        tassert(ta->ran == 1);
+        if (others == 0) {
+            /* Without another worker to steal the task, the limit must be raised */
+            mprGetWorkerStats(&stats);
+            tassert(stats.grown > grown);
+        }
+    }
+    for (i = 0; i < 300 && ta->spinning; i++) {
+        mprNap(10);
+    }
+    mprSetWorkerLatency(0);
+    mprGetWorkerStats(&stats);
+    tassert(stats.target == 0);
+
+    for (ITERATE_ITEMS(ta->dispatchers, dispatcher, next)) {
+        mprDestroyDispatcher(dispatcher);
+    }
+}
+
+
+#if MPR_AFFINITY
+static void testAffinity(MprTestGroup *gp)
+{
+    MprThread   *tp;
+    cpu_set_t   original, set;
+    char        *cpus, cpu[16];
+    int         i;
+
+    tassert(mprGetNumaNodes() >= 1);
+    cpus = mprGetNumaNodeCpus(0);
+    tassert(cpus != 0 && isdigit((uchar) *cpus));
+    tassert(mprGetNumaNodeCpus(-1) == 0);
+
+    tp = mprGetCurrentThread();
+    tassert(tp != 0);
+    tassert(mprSetThreadAffinity(tp, "bogus") == MPR_ERR_BAD_ARGS);
+    tassert(mprSetThreadAffinity(tp, "3-1") == MPR_ERR_BAD_ARGS);
+
+    /* Bind to a CPU permitted by the (possibly restricted) process mask */
+    CPU_ZERO(&original);
+    tassert(sched_getaffinity(0, sizeof(original), &original) == 0);
+    for (i = 0; i < CPU_SETSIZE && !CPU_ISSET(i, &original); i++) ;
+    tassert(i < CPU_SETSIZE);
+    fmt(cpu, sizeof(cpu), "%d", i);
+    tassert(mprSetThreadAffinity(tp, cpu) == 0);
+    CPU_ZERO(&set);
+    tassert(pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0);
+    tassert(CPU_COUNT(&set) == 1 && CPU_ISSET(i, &set));
+
+    /* Clearing the affinity restores the process mask */
+    tassert(mprSetThreadAffinity(tp, NULL) == 0);
+    tassert(pthread_getaffinity_np(pthread_self(), sizeof(set), &set) == 0);
+    tassert(CPU_EQUAL(&set, &original));
+
+    tassert(mprSetWorkerAffinity(0, MPR_AFFINITY_NODES) == 0);
+    tassert(mprSetWorkerAffinity(cpus, 0) == 0);
+    tassert(mprSetWorkerAffinity(0, 0) == 0);
+
+    /* Large blocks get their own region which is bound to this node */
+    mprSetMemNuma(1);
+    tassert(mprAlloc(4 * 1024 * 1024) != 0);
+    mprSetMemNuma(0);
+
+    /* Leave this thread with its original mask even if an assertion failed */
+    mprSetThreadAffinity(tp, NULL);
+    pthread_setaffinity_np(pthread_self(), sizeof(original), &original);
+}
+#endif
+
+
 MprTestDef testWorker = {
     "worker", 0, 0, 0,
     {
         MPR_TEST(0, testStartWorker),
+        MPR_TEST(0, testQueueWorkers),
+        MPR_TEST(0, testAdaptiveWorkers),
+#if MPR_AFFINITY
+        MPR_TEST(0, testAffinity),
+#endif
         MPR_TEST(0, 0),
     },
 };